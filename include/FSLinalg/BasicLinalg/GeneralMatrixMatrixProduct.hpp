@@ -2,7 +2,13 @@
 #define FSLINALG_BASIC_LINALG_GENERAL_MATRIX_MATRIX_PRODUCT_HPP
 
 #include <FSLinalg/Scalar.hpp>
-#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/Matrix/MatrixMap.hpp>
+#include <FSLinalg/Matrix/UnitMatrix.hpp>
+#include <FSLinalg/Matrix/SkewMatrix.hpp>
+#include <FSLinalg/Matrix/KroneckerProduct.hpp>
+#include <FSLinalg/Matrix/SplitComplexMatrix.hpp>
+#include <FSLinalg/Matrix/QuantizedMatrix.hpp>
 
 namespace FSLinalg
 {
@@ -23,8 +29,15 @@ struct GeneralMatrixMatrixProduct
 	
 	static_assert(nColsOpA == nRowsOpB, "Matrices sizes must match");
 	
-	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
-	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const Matrix<ScalarB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	// dense operands, Matrix or MatrixMap (read through data())
+	template<Scalar_concept ScalarAlpha, class DenseA, class DenseB, class DenseY>
+	static void run(const ScalarAlpha& alpha, const DenseA& A, const DenseB& B, DenseY& Y) 
+		requires(DenseMatrix_concept<DenseA,nRowsA,nColsA> and DenseMatrix_concept<DenseB,nRowsB,nColsB> and DenseMatrix_concept<DenseY,nRowsY,nColsY>);
+	
+	// maps next to the other operands go through Matrix copies
+	template<Scalar_concept ScalarAlpha, class OperandA, class OperandB, class OperandY>
+	static void run(const ScalarAlpha& alpha, const OperandA& A, const OperandB& B, OperandY& Y) 
+		requires((IsMatrixMap<OperandA>::value or IsMatrixMap<OperandB>::value or IsMatrixMap<OperandY>::value) and not (IsDenseMatrix<OperandA>::value and IsDenseMatrix<OperandB>::value and IsDenseMatrix<OperandY>::value));
 	
 	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarY>
 	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const UnitMatrix<nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
@@ -34,6 +47,76 @@ struct GeneralMatrixMatrixProduct
 	
 	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarY>
 	static void run(const ScalarAlpha& alpha, const UnitMatrix<nRowsA,nColsA>& A, const UnitMatrix<nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	// skew operands, computed as cross products (the transpose of a skew matrix being its opposite)
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const SkewMatrix<ScalarA>& A, const Matrix<ScalarB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const SkewMatrix<ScalarB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const SkewMatrix<ScalarA>& A, const SkewMatrix<ScalarB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	// Kronecker operands, applied one factor at a time: (A (x) B)*x is A*X*transpose(B) with X the row-major reshape of x
+	template<Scalar_concept ScalarAlpha, class FactorA, class FactorB, Scalar_concept ScalarB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const KroneckerProduct<FactorA,FactorB>& A, const Matrix<ScalarB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, class FactorA, class FactorB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const KroneckerProduct<FactorA,FactorB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	// (A1 (x) B1)*(A2 (x) B2) = A1*A2 (x) B1*B2 needs op(A1)*op(A2) and op(B1)*op(B2) to be defined
+	template<class FactorA1, class FactorB1, class FactorA2, class FactorB2>
+	static constexpr bool areKroneckerFactorsAligned = 
+		    ((not transposeA) ? FactorA1::nCols : FactorA1::nRows) == ((not transposeB) ? FactorA2::nRows : FactorA2::nCols)
+		and ((not transposeA) ? FactorB1::nCols : FactorB1::nRows) == ((not transposeB) ? FactorB2::nRows : FactorB2::nCols);
+	
+	template<Scalar_concept ScalarAlpha, class FactorA1, class FactorB1, class FactorA2, class FactorB2, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const KroneckerProduct<FactorA1,FactorB1>& A, const KroneckerProduct<FactorA2,FactorB2>& B, Matrix<ScalarY,nRowsY,nColsY>& Y)
+		requires(areKroneckerFactorsAligned<FactorA1,FactorB1,FactorA2,FactorB2>);
+	
+	// otherwise B is expanded and A applied to it factor by factor
+	template<Scalar_concept ScalarAlpha, class FactorA1, class FactorB1, class FactorA2, class FactorB2, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const KroneckerProduct<FactorA1,FactorB1>& A, const KroneckerProduct<FactorA2,FactorB2>& B, Matrix<ScalarY,nRowsY,nColsY>& Y)
+		requires(not areKroneckerFactorsAligned<FactorA1,FactorB1,FactorA2,FactorB2>);
+	
+	// split complex operands, computed as real products on the planes (or with the 3M method when FSLINALG_CPX_3M is defined)
+	template<Scalar_concept ScalarAlpha, typename T>
+	static void run(const ScalarAlpha& alpha, const SplitComplexMatrix<T,nRowsA,nColsA>& A, const SplitComplexMatrix<T,nRowsB,nColsB>& B, SplitComplexMatrix<T,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const SplitComplexMatrix<T,nRowsA,nColsA>& A, const SplitComplexMatrix<T,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarB, class DstY>
+	static void run(const ScalarAlpha& alpha, const SplitComplexMatrix<T,nRowsA,nColsA>& A, const Matrix<ScalarB,nRowsB,nColsB>& B, DstY& Y);
+	
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, typename T, class DstY>
+	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const SplitComplexMatrix<T,nRowsB,nColsB>& B, DstY& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const SplitComplexMatrix<T,nRowsA,nColsA>& A, const UnitMatrix<nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const UnitMatrix<nRowsA,nColsA>& A, const SplitComplexMatrix<T,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	// quantized operands, computed on the integers and scaled (or requantized for a quantized Y) on store
+	template<typename IntA, typename IntB> 
+	using QuantizedAccumulator = std::common_type_t<typename QuantizedTraits<IntA>::Accumulator, typename QuantizedTraits<IntB>::Accumulator>;
+	
+	template<typename IntA, typename IntB>
+	static std::array<QuantizedAccumulator<IntA,IntB>, nRowsY*nColsY> integerProduct(const QuantizedMatrix<IntA,nRowsA,nColsA>& A, const QuantizedMatrix<IntB,nRowsB,nColsB>& B);
+	
+	template<Scalar_concept ScalarAlpha, typename IntA, typename IntB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const QuantizedMatrix<IntA,nRowsA,nColsA>& A, const QuantizedMatrix<IntB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename IntA, typename IntB, typename IntY>
+	static void run(const ScalarAlpha& alpha, const QuantizedMatrix<IntA,nRowsA,nColsA>& A, const QuantizedMatrix<IntB,nRowsB,nColsB>& B, QuantizedMatrix<IntY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, typename IntA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const QuantizedMatrix<IntA,nRowsA,nColsA>& A, const Matrix<ScalarB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
+	
+	template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, typename IntB, Scalar_concept ScalarY>
+	static void run(const ScalarAlpha& alpha, const Matrix<ScalarA,nRowsA,nColsA>& A, const QuantizedMatrix<IntB,nRowsB,nColsB>& B, Matrix<ScalarY,nRowsY,nColsY>& Y);
 };
 	
 } // namespace BasicLinalg
@@ -4,6 +4,13 @@
 #include <FSLinalg/BasicLinalg/GeneralMatrixMatrixProduct.hpp>
 #include <FSLinalg/BasicLinalg/TripleProduct.hpp>
 #include <FSLinalg/BasicLinalg/Product.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/BasicLinalg/RankUpdate.hpp>
+#include <FSLinalg/misc/Restrict.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 namespace FSLinalg
 {
@@ -11,35 +18,101 @@ namespace BasicLinalg
 {
 
 template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
-template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+template<Scalar_concept ScalarAlpha, class DenseA, class DenseB, class DenseY>
 void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
-	const ScalarAlpha&                   alpha, 
-	const Matrix<ScalarA,nRowsA,nColsA>& A, 
-	const Matrix<ScalarB,nRowsB,nColsB>& B, 
-	      Matrix<ScalarY,nRowsY,nColsY>& Y)
+	const ScalarAlpha& alpha, 
+	const DenseA&      A, 
+	const DenseB&      B, 
+	      DenseY&      Y)
+	requires(DenseMatrix_concept<DenseA,nRowsA,nColsA> and DenseMatrix_concept<DenseB,nRowsB,nColsB> and DenseMatrix_concept<DenseY,nRowsY,nColsY>)
 {
-	using ScaledA = decltype(std::declval<ScalarAlpha>()*std::declval<ScalarA>());
+	using ScalarA = typename DenseA::Scalar;
+	using ScalarB = typename DenseB::Scalar;
+	using ScalarY = typename DenseY::Scalar;
+	
+	// U*transpose(V) with a small inner dimension, U*transpose(U) (U*adjoint(U) when complex) only computes one triangle
+	if constexpr (not transposeA and transposeB and nColsOpA <= RankUpdate<conjugateA, conjugateB, nRowsY, nColsY, nColsOpA, incrDst>::maxRank)
+	{
+		using Update = RankUpdate<conjugateA, conjugateB, nRowsY, nColsY, nColsOpA, incrDst>;
+		
+		if constexpr (nRowsA == nRowsB and std::is_same<ScalarA, ScalarB>::value and not conjugateA and (conjugateB or not IsComplexScalar<ScalarA>::value) and IsRealScalar<ScalarAlpha>::value)
+		{
+			if (A.data() == B.data())
+			{
+				Update::runSymmetric(alpha, A, Y);
+				return;
+			}
+		}
+		
+		Update::run(alpha, A, B, Y);
+		return;
+	}
+	
+	using Accumulator = typename AccumulatorTraits< typename MultiplyAdd<false, conjugateB>::template ReturnType<decltype(std::declval<ScalarAlpha>()*std::declval<ScalarA>()), ScalarB, ScalarY> >::Type;
+	using ScaledA     = typename PromoteTraits< decltype(std::declval<ScalarAlpha>()*std::declval<ScalarA>()), typename NumTraits<Accumulator>::Real >::Type;
 	
 	constexpr Size A_iStride = (not transposeA) ? nColsA : 1;
 	constexpr Size A_kStride = (not transposeA) ?      1 : nColsA;
 	constexpr Size B_kStride = (not transposeB) ? nColsB : 1;
 	constexpr Size B_jStride = (not transposeB) ?      1 : nColsB;
 	
-	constexpr Product<false, conjugateA> prodA;
-	constexpr Product<false, conjugateB> prodB;
+	constexpr Product    <false, conjugateA> prodA;
+	constexpr MultiplyAdd<false, conjugateB> maddB;
 	
-	if constexpr (not incrDst) { Y.setZero(); }
+	// callers never pass a Y read by A or B (aliased products go through a buffer or a temporary)
+	const ScalarA* FSLINALG_RESTRICT a = A.data();
+	const ScalarB* FSLINALG_RESTRICT b = B.data();
+	      ScalarY* FSLINALG_RESTRICT y = Y.data();
+	
+	// each row of Y is accumulated in a buffer of the accumulator type and stored once
+	std::array<Accumulator, nColsY> acc;
 	
 	for (Size i=0; i!=nRowsY; ++i)
 	{
+		for (Size j=0; j!=nColsY; ++j)
+		{
+			if constexpr (incrDst) { acc[j] = static_cast<Accumulator>(y[i*nColsY + j]); }
+			else                   { acc[j] = Accumulator(0);                             }
+		}
 		for (Size k=0; k !=nColsOpA; ++k)
 		{
-			ScaledA alphaA = prodA(alpha, A[i*A_iStride + k*A_kStride]);
+			const ScaledA alphaA = static_cast<ScaledA>(prodA(alpha, a[i*A_iStride + k*A_kStride]));
 			for (Size j=0; j!=nColsY; ++j)
 			{
-				Y(i,j) += prodB(alphaA, B[k*B_kStride + j*B_jStride]);
+				acc[j] = static_cast<Accumulator>(maddB(alphaA, b[k*B_kStride + j*B_jStride], acc[j]));
 			}
 		}
+		for (Size j=0; j!=nColsY; ++j)
+		{
+			y[i*nColsY + j] = static_cast<ScalarY>(acc[j]);
+		}
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, class OperandA, class OperandB, class OperandY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha& alpha, 
+	const OperandA&    A, 
+	const OperandB&    B, 
+	      OperandY&    Y)
+	requires((IsMatrixMap<OperandA>::value or IsMatrixMap<OperandB>::value or IsMatrixMap<OperandY>::value) and not (IsDenseMatrix<OperandA>::value and IsDenseMatrix<OperandB>::value and IsDenseMatrix<OperandY>::value))
+{
+	if constexpr (IsMatrixMap<OperandA>::value)
+	{
+		const Matrix<typename OperandA::Scalar,nRowsA,nColsA> copyA(A);
+		run(alpha, copyA, B, Y);
+	}
+	else if constexpr (IsMatrixMap<OperandB>::value)
+	{
+		const Matrix<typename OperandB::Scalar,nRowsB,nColsB> copyB(B);
+		run(alpha, A, copyB, Y);
+	}
+	else
+	{
+		Matrix<typename OperandY::Scalar,nRowsY,nColsY> copyY(Y);
+		run(alpha, A, B, copyY);
+		Y.noalias() = copyY;
 	}
 }
 
@@ -54,7 +127,7 @@ void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,c
 	constexpr Size A_iStride = (not transposeA) ? nColsA : 1;
 	constexpr Size A_kStride = (not transposeA) ?      1 : nColsA;
 	
-	constexpr Product<false, conjugateA> prod;
+	constexpr MultiplyAdd<false, conjugateA> madd;
 	
 	if constexpr (not incrDst) { Y.setZero(); }
 	
@@ -63,7 +136,7 @@ void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,c
 	
 	for (Size i=0; i!=nRowsY; ++i)
 	{
-		Y(i,j) += prod(alpha, A[i*A_iStride + k*A_kStride]);
+		Y(i,j) = madd(alpha, A[i*A_iStride + k*A_kStride], Y(i,j));
 	}
 }
 
@@ -78,7 +151,7 @@ void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,c
 	constexpr Size B_kStride = (not transposeB) ? nColsB : 1;
 	constexpr Size B_jStride = (not transposeB) ?      1 : nColsB;
 	
-	constexpr Product<false, conjugateB> prod;
+	constexpr MultiplyAdd<false, conjugateB> madd;
 	
 	if constexpr (not incrDst) { Y.setZero(); }
 	
@@ -88,7 +161,7 @@ void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,c
 	
 	for (Size j=0; j!=nColsY; ++j)
 	{
-		Y(i,j) += prod(alpha, B[k*B_kStride + j*B_jStride]);
+		Y(i,j) = madd(alpha, B[k*B_kStride + j*B_jStride], Y(i,j));
 	}
 }
 
@@ -110,6 +183,505 @@ void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,c
 	Y(i,j) += alpha*(k1 == k2);
 }
 
+namespace detail
+{
+
+// alpha, or -alpha when negate is set
+template<bool negate, Scalar_concept ScalarAlpha>
+constexpr auto signedAlpha(const ScalarAlpha& alpha)
+{
+	if constexpr (negate) { return -alpha; }
+	else                  { return  alpha; }
+}
+
+template<bool incrDst, Scalar_concept ScalarY, Scalar_concept Value>
+void storeOrIncrement(ScalarY& y, const Value& value)
+{
+	if constexpr (incrDst) { y = static_cast<ScalarY>(y + value); }
+	else                   { y = static_cast<ScalarY>(value);     }
+}
+
+} // namespace detail
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                   alpha, 
+	const SkewMatrix<ScalarA>&           A, 
+	const Matrix<ScalarB,nRowsB,nColsB>& B, 
+	      Matrix<ScalarY,nRowsY,nColsY>& Y)
+{
+	constexpr Size B_kStride = (not transposeB) ? nColsB : 1;
+	constexpr Size B_jStride = (not transposeB) ?      1 : nColsB;
+	
+	constexpr Product<conjugateA, conjugateB> prod;
+	
+	const auto  beta = detail::signedAlpha<transposeA>(alpha);
+	const auto& a    = A.vector();
+	
+	// column j of Y is op(a) x op(B)(:,j)
+	for (Size j=0; j!=nColsY; ++j)
+	{
+		const ScalarB& b0 = B[0*B_kStride + j*B_jStride];
+		const ScalarB& b1 = B[1*B_kStride + j*B_jStride];
+		const ScalarB& b2 = B[2*B_kStride + j*B_jStride];
+		
+		detail::storeOrIncrement<incrDst>(Y(0,j), beta*(prod(a[1], b2) - prod(a[2], b1)));
+		detail::storeOrIncrement<incrDst>(Y(1,j), beta*(prod(a[2], b0) - prod(a[0], b2)));
+		detail::storeOrIncrement<incrDst>(Y(2,j), beta*(prod(a[0], b1) - prod(a[1], b0)));
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                   alpha, 
+	const Matrix<ScalarA,nRowsA,nColsA>& A, 
+	const SkewMatrix<ScalarB>&           B, 
+	      Matrix<ScalarY,nRowsY,nColsY>& Y)
+{
+	constexpr Size A_iStride = (not transposeA) ? nColsA : 1;
+	constexpr Size A_kStride = (not transposeA) ?      1 : nColsA;
+	
+	constexpr Product<conjugateA, conjugateB> prod;
+	
+	const auto  beta = detail::signedAlpha<transposeB>(alpha);
+	const auto& b    = B.vector();
+	
+	// row i of Y is op(A)(i,:) x op(b), since r^T [b]x = (r x b)^T
+	for (Size i=0; i!=nRowsY; ++i)
+	{
+		const ScalarA& r0 = A[i*A_iStride + 0*A_kStride];
+		const ScalarA& r1 = A[i*A_iStride + 1*A_kStride];
+		const ScalarA& r2 = A[i*A_iStride + 2*A_kStride];
+		
+		detail::storeOrIncrement<incrDst>(Y(i,0), beta*(prod(r1, b[2]) - prod(r2, b[1])));
+		detail::storeOrIncrement<incrDst>(Y(i,1), beta*(prod(r2, b[0]) - prod(r0, b[2])));
+		detail::storeOrIncrement<incrDst>(Y(i,2), beta*(prod(r0, b[1]) - prod(r1, b[0])));
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                   alpha, 
+	const SkewMatrix<ScalarA>&           A, 
+	const SkewMatrix<ScalarB>&           B, 
+	      Matrix<ScalarY,nRowsY,nColsY>& Y)
+{
+	constexpr Product<conjugateB, conjugateA> prod;
+	
+	const auto  beta = detail::signedAlpha<transposeA != transposeB>(alpha);
+	const auto& a    = A.vector();
+	const auto& b    = B.vector();
+	
+	// [a]x [b]x = b a^T - (a.b) I
+	const auto dot = prod(b[0], a[0]) + prod(b[1], a[1]) + prod(b[2], a[2]);
+	
+	for (Size i=0; i!=3; ++i)
+	{
+		for (Size j=0; j!=3; ++j)
+		{
+			if (i == j) { detail::storeOrIncrement<incrDst>(Y(i,j), beta*(prod(b[i], a[j]) - dot)); }
+			else        { detail::storeOrIncrement<incrDst>(Y(i,j), beta*prod(b[i], a[j]));         }
+		}
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, class FactorA, class FactorB, Scalar_concept ScalarB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                        alpha, 
+	const KroneckerProduct<FactorA,FactorB>&  A, 
+	const Matrix<ScalarB,nRowsB,nColsB>&      B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&      Y)
+{
+	// op(A) = op(FA) (x) op(FB), with op(FA) of size m x n and op(FB) of size p x q
+	constexpr Size m = (not transposeA) ? FactorA::nRows : FactorA::nCols;
+	constexpr Size n = (not transposeA) ? FactorA::nCols : FactorA::nRows;
+	constexpr Size p = (not transposeA) ? FactorB::nRows : FactorB::nCols;
+	constexpr Size q = (not transposeA) ? FactorB::nCols : FactorB::nRows;
+	
+	constexpr Size B_kStride = (not transposeB) ? nColsB : 1;
+	constexpr Size B_jStride = (not transposeB) ?      1 : nColsB;
+	
+	constexpr bool applyLhsFirst = m*n*q + m*q*p <= n*q*p + m*n*p;
+	
+	using RealY = typename NumTraits<ScalarY>::Real;
+	
+	using GemmLhs = GeneralMatrixMatrixProduct<transposeA, conjugateA, FactorA::nRows, FactorA::nCols, false, conjugateB, n, q, false>;
+	using GemmRhs = GeneralMatrixMatrixProduct<false, conjugateB, n, q, not transposeA, conjugateA, FactorB::nRows, FactorB::nCols, false>;
+	
+	Matrix<ScalarB, n, q> X(ScalarB(0));
+	Matrix<ScalarY, m, p> Yc(ScalarY(0));
+	
+	// column j of Y is op(FA)*X*transpose(op(FB)), X being column j of op(B) reshaped
+	for (Size j=0; j!=nColsY; ++j)
+	{
+		for (Size k=0; k!=n*q; ++k) { X[k] = B[k*B_kStride + j*B_jStride]; }
+		
+		if constexpr (applyLhsFirst)
+		{
+			Matrix<ScalarY, m, q> tmp(ScalarY(0));
+			GemmLhs::run(alpha, A.lhs(), X, tmp);
+			GeneralMatrixMatrixProduct<false, false, m, q, not transposeA, conjugateA, FactorB::nRows, FactorB::nCols, false>::run(RealY(1), tmp, A.rhs(), Yc);
+		}
+		else
+		{
+			Matrix<ScalarY, n, p> tmp(ScalarY(0));
+			GemmRhs::run(alpha, X, A.rhs(), tmp);
+			GeneralMatrixMatrixProduct<transposeA, conjugateA, FactorA::nRows, FactorA::nCols, false, false, n, p, false>::run(RealY(1), A.lhs(), tmp, Yc);
+		}
+		
+		for (Size i=0; i!=nRowsY; ++i) { detail::storeOrIncrement<incrDst>(Y(i,j), Yc[i]); }
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, class FactorA, class FactorB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                        alpha, 
+	const Matrix<ScalarA,nRowsA,nColsA>&      A, 
+	const KroneckerProduct<FactorA,FactorB>&  B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&      Y)
+{
+	// op(B) = op(FA) (x) op(FB), with op(FA) of size m x n and op(FB) of size p x q
+	constexpr Size m = (not transposeB) ? FactorA::nRows : FactorA::nCols;
+	constexpr Size n = (not transposeB) ? FactorA::nCols : FactorA::nRows;
+	constexpr Size p = (not transposeB) ? FactorB::nRows : FactorB::nCols;
+	constexpr Size q = (not transposeB) ? FactorB::nCols : FactorB::nRows;
+	
+	constexpr Size A_iStride = (not transposeA) ? nColsA : 1;
+	constexpr Size A_kStride = (not transposeA) ?      1 : nColsA;
+	
+	constexpr bool applyLhsFirst = n*m*p + n*p*q <= m*p*q + n*m*q;
+	
+	using RealY = typename NumTraits<ScalarY>::Real;
+	
+	using GemmLhs = GeneralMatrixMatrixProduct<not transposeB, conjugateB, FactorA::nRows, FactorA::nCols, false, conjugateA, m, p, false>;
+	using GemmRhs = GeneralMatrixMatrixProduct<false, conjugateA, m, p, transposeB, conjugateB, FactorB::nRows, FactorB::nCols, false>;
+	
+	Matrix<ScalarA, m, p> X(ScalarA(0));
+	Matrix<ScalarY, n, q> Yr(ScalarY(0));
+	
+	// row i of Y is transpose(op(FA))*X*op(FB), X being row i of op(A) reshaped
+	for (Size i=0; i!=nRowsY; ++i)
+	{
+		for (Size k=0; k!=m*p; ++k) { X[k] = A[i*A_iStride + k*A_kStride]; }
+		
+		if constexpr (applyLhsFirst)
+		{
+			Matrix<ScalarY, n, p> tmp(ScalarY(0));
+			GemmLhs::run(alpha, B.lhs(), X, tmp);
+			GeneralMatrixMatrixProduct<false, false, n, p, transposeB, conjugateB, FactorB::nRows, FactorB::nCols, false>::run(RealY(1), tmp, B.rhs(), Yr);
+		}
+		else
+		{
+			Matrix<ScalarY, m, q> tmp(ScalarY(0));
+			GemmRhs::run(alpha, X, B.rhs(), tmp);
+			GeneralMatrixMatrixProduct<not transposeB, conjugateB, FactorA::nRows, FactorA::nCols, false, false, m, q, false>::run(RealY(1), B.lhs(), tmp, Yr);
+		}
+		
+		for (Size j=0; j!=nColsY; ++j) { detail::storeOrIncrement<incrDst>(Y(i,j), Yr[j]); }
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, class FactorA1, class FactorB1, class FactorA2, class FactorB2, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                          alpha, 
+	const KroneckerProduct<FactorA1,FactorB1>&  A, 
+	const KroneckerProduct<FactorA2,FactorB2>&  B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&        Y)
+	requires(areKroneckerFactorsAligned<FactorA1,FactorB1,FactorA2,FactorB2>)
+{
+	using GemmLhs = GeneralMatrixMatrixProduct<transposeA, conjugateA, FactorA1::nRows, FactorA1::nCols, transposeB, conjugateB, FactorA2::nRows, FactorA2::nCols, false>;
+	using GemmRhs = GeneralMatrixMatrixProduct<transposeA, conjugateA, FactorB1::nRows, FactorB1::nCols, transposeB, conjugateB, FactorB2::nRows, FactorB2::nCols, false>;
+	
+	using RealY = typename NumTraits<ScalarY>::Real;
+	
+	constexpr Size p = GemmRhs::nRowsY;
+	constexpr Size q = GemmRhs::nColsY;
+	
+	// op(A1 (x) B1)*op(A2 (x) B2) = (op(A1)*op(A2)) (x) (op(B1)*op(B2))
+	Matrix<ScalarY, GemmLhs::nRowsY, GemmLhs::nColsY> C(ScalarY(0));
+	Matrix<ScalarY, p, q>                             D(ScalarY(0));
+	GemmLhs::run(alpha,    A.lhs(), B.lhs(), C);
+	GemmRhs::run(RealY(1), A.rhs(), B.rhs(), D);
+	
+	for (Size i=0; i!=nRowsY; ++i)
+	{
+		for (Size j=0; j!=nColsY; ++j) { detail::storeOrIncrement<incrDst>(Y(i,j), C(i/p, j/q)*D(i%p, j%q)); }
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, class FactorA1, class FactorB1, class FactorA2, class FactorB2, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                          alpha, 
+	const KroneckerProduct<FactorA1,FactorB1>&  A, 
+	const KroneckerProduct<FactorA2,FactorB2>&  B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&        Y)
+	requires(not areKroneckerFactorsAligned<FactorA1,FactorB1,FactorA2,FactorB2>)
+{
+	const Matrix<typename KroneckerProduct<FactorA2,FactorB2>::Scalar, nRowsB, nColsB> denseB(B);
+	run(alpha, A, denseB, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename T>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const SplitComplexMatrix<T,nRowsA,nColsA>&       A, 
+	const SplitComplexMatrix<T,nRowsB,nColsB>&       B, 
+	      SplitComplexMatrix<T,nRowsY,nColsY>&       Y)
+{
+	if constexpr (IsComplexScalar<ScalarAlpha>::value)
+	{
+		using GemmAssign = GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,false>;
+		
+		SplitComplexMatrix<T,nRowsY,nColsY> P;
+		GemmAssign::run(T(1), A, B, P);
+		
+		const T alpha_re = real(alpha);
+		const T alpha_im = imag(alpha);
+		
+		for (Size i=0; i!=nRowsY*nColsY; ++i)
+		{
+			const T re = alpha_re*P.getReal()[i] - alpha_im*P.getImag()[i];
+			const T im = alpha_re*P.getImag()[i] + alpha_im*P.getReal()[i];
+			
+			if constexpr (incrDst) { Y.getReal()[i] += re; Y.getImag()[i] += im; }
+			else                   { Y.getReal()[i]  = re; Y.getImag()[i]  = im; }
+		}
+	}
+	else
+	{
+		// op(A) = Ar + i*sa*Ai and op(B) = Br + i*sb*Bi
+		constexpr T sa = conjugateA ? T(-1) : T(1);
+		constexpr T sb = conjugateB ? T(-1) : T(1);
+		
+#ifdef FSLINALG_CPX_3M
+		using RealGemmAssign = GeneralMatrixMatrixProduct<transposeA,false,nRowsA,nColsA,transposeB,false,nRowsB,nColsB,false>;
+		
+		// Pr = Ar*Br - sa*sb*Ai*Bi and Pi = (Ar + sa*Ai)*(Br + sb*Bi) - Ar*Br - sa*sb*Ai*Bi
+		const Matrix<T,nRowsA,nColsA> sumA(A.getReal() + sa*A.getImag());
+		const Matrix<T,nRowsB,nColsB> sumB(B.getReal() + sb*B.getImag());
+		
+		Matrix<T,nRowsY,nColsY> RR, II, SS;
+		
+		RealGemmAssign::run(T(1), A.getReal(), B.getReal(), RR);
+		RealGemmAssign::run(T(1), A.getImag(), B.getImag(), II);
+		RealGemmAssign::run(T(1), sumA,        sumB,        SS);
+		
+		for (Size i=0; i!=nRowsY*nColsY; ++i)
+		{
+			const T re = alpha*(RR[i] - sa*sb*II[i]);
+			const T im = alpha*(SS[i] - RR[i] - sa*sb*II[i]);
+			
+			if constexpr (incrDst) { Y.getReal()[i] += re; Y.getImag()[i] += im; }
+			else                   { Y.getReal()[i]  = re; Y.getImag()[i]  = im; }
+		}
+#else
+		using RealGemmIncrement = GeneralMatrixMatrixProduct<transposeA,false,nRowsA,nColsA,transposeB,false,nRowsB,nColsB,true>;
+		using RealGemmDst       = GeneralMatrixMatrixProduct<transposeA,false,nRowsA,nColsA,transposeB,false,nRowsB,nColsB,incrDst>;
+		
+		RealGemmDst      ::run(       alpha, A.getReal(), B.getReal(), Y.getReal());
+		RealGemmIncrement::run(-sa*sb*alpha, A.getImag(), B.getImag(), Y.getReal());
+		RealGemmDst      ::run(    sb*alpha, A.getReal(), B.getImag(), Y.getImag());
+		RealGemmIncrement::run(    sa*alpha, A.getImag(), B.getReal(), Y.getImag());
+#endif
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const SplitComplexMatrix<T,nRowsA,nColsA>&       A, 
+	const SplitComplexMatrix<T,nRowsB,nColsB>&       B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&             Y)
+{
+	using GemmAssign = GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,false>;
+	
+	SplitComplexMatrix<T,nRowsY,nColsY> P;
+	GemmAssign::run(alpha, A, B, P);
+	
+	for (Size i=0; i!=nRowsY*nColsY; ++i)
+	{
+		if constexpr (incrDst) { Y[i] += P[i]; }
+		else                   { Y[i]  = P[i]; }
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarB, class DstY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const SplitComplexMatrix<T,nRowsA,nColsA>&       A, 
+	const Matrix<ScalarB,nRowsB,nColsB>&             B, 
+	      DstY&                                      Y)
+{
+	const SplitComplexMatrix<T,nRowsB,nColsB> splitB(B);
+	run(alpha, A, splitB, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, typename T, class DstY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const Matrix<ScalarA,nRowsA,nColsA>&             A, 
+	const SplitComplexMatrix<T,nRowsB,nColsB>&       B, 
+	      DstY&                                      Y)
+{
+	const SplitComplexMatrix<T,nRowsA,nColsA> splitA(A);
+	run(alpha, splitA, B, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const SplitComplexMatrix<T,nRowsA,nColsA>&       A, 
+	const UnitMatrix<nRowsB,nColsB>&                 B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&             Y)
+{
+	const Matrix<std::complex<T>,nRowsA,nColsA> interleavedA(A);
+	run(alpha, interleavedA, B, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename T, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                               alpha, 
+	const UnitMatrix<nRowsA,nColsA>&                 A, 
+	const SplitComplexMatrix<T,nRowsB,nColsB>&       B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&             Y)
+{
+	const Matrix<std::complex<T>,nRowsB,nColsB> interleavedB(B);
+	run(alpha, A, interleavedB, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<typename IntA, typename IntB>
+auto GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::integerProduct(
+	const QuantizedMatrix<IntA,nRowsA,nColsA>& A, 
+	const QuantizedMatrix<IntB,nRowsB,nColsB>& B) -> std::array<QuantizedAccumulator<IntA,IntB>, nRowsY*nColsY>
+{
+	using Operand     = std::common_type_t<typename QuantizedTraits<IntA>::Operand, typename QuantizedTraits<IntB>::Operand>;
+	using Accumulator = QuantizedAccumulator<IntA,IntB>;
+	
+	constexpr Size nK = nColsOpA;
+	
+	constexpr Size A_iStride = (not transposeA) ? nColsA : 1;
+	constexpr Size A_kStride = (not transposeA) ?      1 : nColsA;
+	constexpr Size B_kStride = (not transposeB) ? nColsB : 1;
+	constexpr Size B_jStride = (not transposeB) ?      1 : nColsB;
+	
+	const std::int32_t zeroPointA = A.getQuantization().zeroPoint;
+	const std::int32_t zeroPointB = B.getQuantization().zeroPoint;
+	
+	// op(B) is packed column by column so that every entry of Y is a contiguous dot product on widened integers
+	std::array<Operand, nColsY*nK> packedB;
+	for (Size j=0; j!=nColsY; ++j)
+	{
+		for (Size k=0; k!=nK; ++k) { packedB[j*nK + k] = static_cast<Operand>(std::int32_t(B.getQuantized(k*B_kStride + j*B_jStride)) - zeroPointB); }
+	}
+	
+	std::array<Accumulator, nRowsY*nColsY> acc;
+	std::array<Operand, nK>                rowA;
+	
+	for (Size i=0; i!=nRowsY; ++i)
+	{
+		for (Size k=0; k!=nK; ++k) { rowA[k] = static_cast<Operand>(std::int32_t(A.getQuantized(i*A_iStride + k*A_kStride)) - zeroPointA); }
+		
+		for (Size j=0; j!=nColsY; ++j)
+		{
+			const Operand* colB = packedB.data() + j*nK;
+			
+			Accumulator sum = 0;
+			for (Size k=0; k!=nK; ++k) { sum += Accumulator(rowA[k])*Accumulator(colB[k]); }
+			
+			acc[i*nColsY + j] = sum;
+		}
+	}
+	
+	return acc;
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename IntA, typename IntB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                         alpha, 
+	const QuantizedMatrix<IntA,nRowsA,nColsA>& A, 
+	const QuantizedMatrix<IntB,nRowsB,nColsB>& B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&       Y)
+{
+	static_assert(IsRealScalar<ScalarAlpha>::value, "Quantized products only support real scaling");
+	
+	using Real = std::common_type_t<typename NumTraits<ScalarY>::Real, float>;
+	
+	const auto acc        = integerProduct(A, B);
+	const Real multiplier = static_cast<Real>(alpha)*Real(A.getQuantization().scale)*Real(B.getQuantization().scale);
+	
+	for (Size i=0; i!=nRowsY*nColsY; ++i)
+	{
+		const ScalarY y = static_cast<ScalarY>(multiplier*static_cast<Real>(acc[i]));
+		
+		if constexpr (incrDst) { Y[i] += y; }
+		else                   { Y[i]  = y; }
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename IntA, typename IntB, typename IntY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                         alpha, 
+	const QuantizedMatrix<IntA,nRowsA,nColsA>& A, 
+	const QuantizedMatrix<IntB,nRowsB,nColsB>& B, 
+	      QuantizedMatrix<IntY,nRowsY,nColsY>& Y)
+{
+	static_assert(IsRealScalar<ScalarAlpha>::value, "Quantized products only support real scaling");
+	static_assert(not incrDst, "Quantized matrices cannot be incremented");
+	
+	constexpr float qmin = float(std::numeric_limits<IntY>::min());
+	constexpr float qmax = float(std::numeric_limits<IntY>::max());
+	
+	const auto  acc        = integerProduct(A, B);
+	const float multiplier = static_cast<float>(alpha)*A.getQuantization().scale*B.getQuantization().scale/Y.getQuantization().scale;
+	const float zeroPointY = static_cast<float>(Y.getQuantization().zeroPoint);
+	
+	for (Size i=0; i!=nRowsY*nColsY; ++i)
+	{
+		const float q = std::nearbyint(multiplier*static_cast<float>(acc[i])) + zeroPointY;
+		Y.getQuantized(i) = static_cast<IntY>(std::clamp(q, qmin, qmax));
+	}
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, typename IntA, Scalar_concept ScalarB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                         alpha, 
+	const QuantizedMatrix<IntA,nRowsA,nColsA>& A, 
+	const Matrix<ScalarB,nRowsB,nColsB>&       B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&       Y)
+{
+	const Matrix<float,nRowsA,nColsA> dequantizedA(A);
+	run(alpha, dequantizedA, B, Y);
+}
+
+template<bool transposeA, bool conjugateA, unsigned int nRowsA, unsigned int nColsA, bool transposeB, bool conjugateB, unsigned int nRowsB, unsigned int nColsB, bool incrDst>
+template<Scalar_concept ScalarAlpha, Scalar_concept ScalarA, typename IntB, Scalar_concept ScalarY>
+void GeneralMatrixMatrixProduct<transposeA,conjugateA,nRowsA,nColsA,transposeB,conjugateB,nRowsB,nColsB,incrDst>::run(
+	const ScalarAlpha&                         alpha, 
+	const Matrix<ScalarA,nRowsA,nColsA>&       A, 
+	const QuantizedMatrix<IntB,nRowsB,nColsB>& B, 
+	      Matrix<ScalarY,nRowsY,nColsY>&       Y)
+{
+	const Matrix<float,nRowsB,nColsB> dequantizedB(B);
+	run(alpha, A, dequantizedB, Y);
+}
+
 } // namespace BasicLinalg
 } // namespace FSLinalg
 
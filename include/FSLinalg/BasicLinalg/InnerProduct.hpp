@@ -1,8 +1,9 @@
 #ifndef FSLINALG_INNER_PRODUCT_HPP
 #define FSLINALG_INNER_PRODUCT_HPP
 
-#include <FSLinalg/Vector/VectorBase.hpp>
-#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix.hpp>
+
+#include <span>
 
 namespace FSLinalg
 {
@@ -10,8 +11,12 @@ namespace FSLinalg
 template<class Lhs, class Rhs>
 using InnerProductScalar = decltype(conj(std::declval<typename Lhs::Scalar>()) * std::declval<typename Rhs::Scalar>());
 
-template<class Lhs, class Rhs> InnerProductScalar<Lhs,Rhs> inner(const MatrixBase<Lhs>& base_lhs, const MatrixBase<Rhs>& base_rhs);
+// Acc is the accumulator type, AccumulatorTraits<InnerProductScalar<Lhs,Rhs>>::Type by default
+template<typename Acc = void, class Lhs, class Rhs> AccumulatorType< Acc, InnerProductScalar<Lhs,Rhs> > inner(const MatrixBase<Lhs>& base_lhs, const MatrixBase<Rhs>& base_rhs);
 
+// res[p] = inner(lhs[p], rhs[p]), bitwise identical to the unbatched version. Pairs are reduced four at a time with
+// interleaved accumulators, which keeps independent multiply-adds in flight for short vectors.
+template<typename Acc = void, class Lhs, class Rhs, Scalar_concept Res> void inner(std::span<const Lhs> lhs, std::span<const Rhs> rhs, std::span<Res> res) requires(IsMatrix<Lhs>::value and IsMatrix<Rhs>::value);
 	
 } // namespace FSLinalg
 
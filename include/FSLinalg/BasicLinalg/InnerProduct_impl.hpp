@@ -2,50 +2,106 @@
 #define FSLINALG_INNER_PRODUCT_IMPL_HPP
 
 #include <FSLinalg/Scalar.hpp>
-#include <FSLinalg/BasicLinalg/Product.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/BasicLinalg/Reduction.hpp>
 #include <FSLinalg/BasicLinalg/InnerProduct.hpp>
 
+#include <array>
+#include <cassert>
+
 namespace FSLinalg
 {
 
-template<class Lhs, class Rhs>
-InnerProductScalar<Lhs,Rhs> inner(const MatrixBase<Lhs>& base_lhs, const MatrixBase<Rhs>& base_rhs)
+template<typename Acc, class Lhs, class Rhs>
+AccumulatorType< Acc, InnerProductScalar<Lhs,Rhs> > inner(const MatrixBase<Lhs>& base_lhs, const MatrixBase<Rhs>& base_rhs)
 {
-	static_assert(Lhs::nRows == Rhs::nCols, "Matrices sizes must match");
+	static_assert(Lhs::nRows == Rhs::nRows, "Matrices sizes must match");
 	static_assert(Lhs::nCols == Rhs::nCols, "Matrices sizes must match");
 	
 	using TmpLhs = std::conditional_t<Lhs::hasReadRandomAccess, const Lhs&, Matrix<typename Lhs::Scalar, Lhs::nRows, Lhs::nCols> >;
 	using TmpRhs = std::conditional_t<Rhs::hasReadRandomAccess, const Rhs&, Matrix<typename Rhs::Scalar, Rhs::nRows, Rhs::nCols> >;
 	
-	using Size   = std::common_type_t<typename Lhs::Size, typename Rhs::Size>;
-	using Scalar = InnerProductScalar<Lhs,Rhs>;
+	using Size        = std::common_type_t<typename Lhs::Size, typename Rhs::Size>;
+	using Accumulator = AccumulatorType< Acc, InnerProductScalar<Lhs,Rhs> >;
+	using RealAcc     = typename NumTraits<Accumulator>::Real;
+	using LhsScalar   = typename PromoteTraits<typename Lhs::Scalar, RealAcc>::Type;
+	using RhsScalar   = typename PromoteTraits<typename Rhs::Scalar, RealAcc>::Type;
 	
-	constexpr BasicLinalg::Product<true,false> prod;
+	constexpr BasicLinalg::MultiplyAdd<true,false> madd;
 	
 	TmpLhs lhs(base_lhs.derived());
 	TmpRhs rhs(base_rhs.derived());
 	
-	Scalar res(0);
-	
-	if constexpr (lhs.hasFlatRandomAccess and rhs.hasFlatRandomAccess)
+	if constexpr (std::decay_t<TmpLhs>::hasFlatRandomAccess and std::decay_t<TmpRhs>::hasFlatRandomAccess)
 	{
-		for (Size i=0; i!=Lhs::size; ++i)
+		return BasicLinalg::Reduction<Lhs::size>::template run<Accumulator>([&](Accumulator& acc, const Size i) -> void
 		{
-			res += prod(lhs[i], rhs[i]);
-		}
+			acc = static_cast<Accumulator>(madd(static_cast<LhsScalar>(lhs[i]), static_cast<RhsScalar>(rhs[i]), acc));
+		});
 	}
 	else
 	{
-		for (Size i=0; i!=lhs.nRows; ++i)
+		return BasicLinalg::Reduction<Lhs::size>::template run<Accumulator>([&](Accumulator& acc, const Size i) -> void
+		{
+			const Size row = i / Lhs::nCols;
+			const Size col = i % Lhs::nCols;
+			acc = static_cast<Accumulator>(madd(static_cast<LhsScalar>(lhs(row, col)), static_cast<RhsScalar>(rhs(row, col)), acc));
+		});
+	}
+}
+
+template<typename Acc, class Lhs, class Rhs, Scalar_concept Res> 
+void inner(std::span<const Lhs> lhs, std::span<const Rhs> rhs, std::span<Res> res) requires(IsMatrix<Lhs>::value and IsMatrix<Rhs>::value)
+{
+	static_assert(Lhs::nRows == Rhs::nRows, "Matrices sizes must match");
+	static_assert(Lhs::nCols == Rhs::nCols, "Matrices sizes must match");
+	static_assert(Lhs::hasReadRandomAccess and Rhs::hasReadRandomAccess, "Batched matrices must have read random access");
+	
+	assert(lhs.size() == rhs.size() and lhs.size() == res.size());
+	
+	using Size        = std::common_type_t<typename Lhs::Size, typename Rhs::Size>;
+	using Accumulator = AccumulatorType< Acc, InnerProductScalar<Lhs,Rhs> >;
+	using RealAcc     = typename NumTraits<Accumulator>::Real;
+	using LhsScalar   = typename PromoteTraits<typename Lhs::Scalar, RealAcc>::Type;
+	using RhsScalar   = typename PromoteTraits<typename Rhs::Scalar, RealAcc>::Type;
+	
+	// pairs interleaved in one pass, each with the accumulators and combine tree of the unbatched version
+	constexpr size_t nPairs = 4;
+	using Accumulators = std::array<Accumulator, nPairs>;
+	
+	constexpr BasicLinalg::MultiplyAdd<true,false> madd;
+	
+	const auto at = []<class Expr>(const Expr& expr, const Size i) -> decltype(auto)
+	{
+		if constexpr (Expr::hasFlatRandomAccess) { return expr[i];                                  }
+		else                                     { return expr(i / Expr::nCols, i % Expr::nCols); }
+	};
+	
+	const auto combine = [](const Accumulators& a, const Accumulators& b) -> Accumulators
+	{
+		Accumulators ret;
+		for (size_t q=0; q!=nPairs; ++q) { ret[q] = a[q] + b[q]; }
+		return ret;
+	};
+	
+	const size_t nInterleaved = res.size() - res.size() % nPairs;
+	for (size_t p=0; p!=nInterleaved; p+=nPairs)
+	{
+		const Accumulators sums = BasicLinalg::Reduction<Lhs::size>::run([&](Accumulators& acc, const Size i) -> void
 		{
-			for (Size j=0; j!=rhs.nCols; ++j)
+			for (size_t q=0; q!=nPairs; ++q)
 			{
-				res += prod(lhs(i,j), rhs(i,j));
+				acc[q] = static_cast<Accumulator>(madd(static_cast<LhsScalar>(at(lhs[p+q], i)), static_cast<RhsScalar>(at(rhs[p+q], i)), acc[q]));
 			}
-		}
+		}, Accumulators{}, combine);
+		
+		for (size_t q=0; q!=nPairs; ++q) { res[p+q] = static_cast<Res>(sums[q]); }
 	}
 	
-	return res;
+	for (size_t p=nInterleaved; p!=res.size(); ++p)
+	{
+		res[p] = static_cast<Res>(inner<Acc>(lhs[p], rhs[p]));
+	}
 }
 	
 } // namespace FSLinalg
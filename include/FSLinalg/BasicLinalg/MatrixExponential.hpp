@@ -0,0 +1,47 @@
+#ifndef FSLINALG_MATRIX_EXPONENTIAL_HPP
+#define FSLINALG_MATRIX_EXPONENTIAL_HPP
+
+#include <FSLinalg/Matrix.hpp>
+
+#include <array>
+#include <limits>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+/*
+ * [m/m] Pade approximant of exp and the largest 1-norm theta for which it is accurate to the unit roundoff of T 
+ * (Higham, "The scaling and squaring method for the matrix exponential revisited", 2005). 
+ * Degree 13 is used for double precision and wider, degree 7 below.
+ */
+template<typename Real>
+struct PadeExp
+{
+	static constexpr bool isDoubleOrWider = std::numeric_limits<Real>::digits >= std::numeric_limits<double>::digits;
+	
+	static constexpr unsigned int degree = isDoubleOrWider ? 13 : 7;
+	
+	static constexpr Real theta = isDoubleOrWider ? Real(5.371920351148152) : Real(3.925724783138660);
+	
+	// b_j = (2m-j)! m! / ((2m)! j! (m-j)!), scaled so that b_m = 1
+	static constexpr std::array<Real, degree+1> coefficients();
+};
+
+} // namespace detail
+
+/*
+ * Exponential of a square matrix by scaling and squaring: A is scaled by 2^-s so that its 1-norm is below 
+ * PadeExp::theta, exp(2^-s A) is approximated by a Pade approximant (one LU solve) and squared s times. 
+ * The Pade degree is fixed at compile time, s depends on the norm of A. Every temporary lives on the stack.
+ */
+template<class Expr> requires(Expr::nRows == Expr::nCols)
+Matrix<typename Expr::Scalar, Expr::nRows, Expr::nCols> exp(const MatrixBase<Expr>& A);
+
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/MatrixExponential_impl.hpp>
+
+#endif // FSLINALG_MATRIX_EXPONENTIAL_HPP
@@ -0,0 +1,115 @@
+#ifndef FSLINALG_MATRIX_EXPONENTIAL_IMPL_HPP
+#define FSLINALG_MATRIX_EXPONENTIAL_IMPL_HPP
+
+#include <FSLinalg/BasicLinalg/MatrixExponential.hpp>
+#include <FSLinalg/BasicLinalg/PartialPivotLU.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+template<typename Real>
+constexpr auto PadeExp<Real>::coefficients() -> std::array<Real, degree+1>
+{
+	// b_{j+1} = b_j (m - j) / ((2m - j) (j + 1)), starting from b_0 and rescaled by b_m
+	std::array<long double, degree+1> b{};
+	b[0] = 1.0L;
+	for (unsigned int j=0; j!=degree; ++j)
+	{
+		b[j+1] = b[j]*static_cast<long double>(degree - j)/static_cast<long double>((2*degree - j)*(j + 1));
+	}
+	
+	std::array<Real, degree+1> ret{};
+	for (unsigned int j=0; j!=degree+1; ++j) { ret[j] = static_cast<Real>(b[j]/b[degree]); }
+	return ret;
+}
+
+} // namespace detail
+
+template<class Expr> requires(Expr::nRows == Expr::nCols)
+Matrix<typename Expr::Scalar, Expr::nRows, Expr::nCols> exp(const MatrixBase<Expr>& base_A)
+{
+	using Scalar     = typename Expr::Scalar;
+	using RealScalar = typename Expr::RealScalar;
+	using Size       = unsigned int;
+	using Mat        = Matrix<Scalar, Expr::nRows, Expr::nCols>;
+	using Pade       = detail::PadeExp<RealScalar>;
+	
+	constexpr Size N = Expr::nRows;
+	constexpr auto b = Pade::coefficients();
+	
+	Mat A(base_A.derived());
+	
+	RealScalar norm1(0);
+	for (Size j=0; j!=N; ++j)
+	{
+		RealScalar colSum(0);
+		for (Size i=0; i!=N; ++i) { colSum += abs(A(i,j)); }
+		norm1 = std::max(norm1, colSum);
+	}
+	
+	int nSquarings = 0;
+	if (norm1 > Pade::theta)
+	{
+		nSquarings = static_cast<int>(std::ceil(std::log2(norm1/Pade::theta)));
+		A *= std::ldexp(RealScalar(1), -nSquarings);
+	}
+	
+	Mat A2(Scalar(RealScalar(0)));
+	Mat A4(Scalar(RealScalar(0)));
+	Mat A6(Scalar(RealScalar(0)));
+	A2.noalias() = A*A;
+	A4.noalias() = A2*A2;
+	A6.noalias() = A2*A4;
+	
+	// exp(A) ~ (V - U)^-1 (V + U), U gathering the odd powers and V the even ones
+	Mat U(Scalar(RealScalar(0)));
+	Mat V(Scalar(RealScalar(0)));
+	
+	if constexpr (Pade::degree == 13)
+	{
+		const Mat Wu = b[13]*A6 + b[11]*A4 + b[9]*A2;
+		const Mat Wv = b[12]*A6 + b[10]*A4 + b[8]*A2;
+		
+		Mat W(Scalar(RealScalar(0)));
+		W.noalias() = A6*Wu;
+		W += b[7]*A6 + b[5]*A4 + b[3]*A2;
+		for (Size i=0; i!=N; ++i) { W(i,i) += b[1]; }
+		U.noalias() = A*W;
+		
+		V.noalias() = A6*Wv;
+		V += b[6]*A6 + b[4]*A4 + b[2]*A2;
+		for (Size i=0; i!=N; ++i) { V(i,i) += b[0]; }
+	}
+	else
+	{
+		static_assert(Pade::degree == 7, "Unsupported Pade degree");
+		
+		Mat W = b[7]*A6 + b[5]*A4 + b[3]*A2;
+		for (Size i=0; i!=N; ++i) { W(i,i) += b[1]; }
+		U.noalias() = A*W;
+		
+		V = b[6]*A6 + b[4]*A4 + b[2]*A2;
+		for (Size i=0; i!=N; ++i) { V(i,i) += b[0]; }
+	}
+	
+	Mat R = PartialPivotLU<Scalar, N>(V - U).solve(V + U);
+	
+	Mat tmp(Scalar(RealScalar(0)));
+	for (int s=0; s!=nSquarings; ++s)
+	{
+		tmp.noalias() = R*R;
+		R = tmp;
+	}
+	
+	return R;
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_EXPONENTIAL_IMPL_HPP
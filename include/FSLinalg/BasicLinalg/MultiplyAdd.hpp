@@ -0,0 +1,41 @@
+#ifndef FSLINALG_BASIC_LINALG_MULTIPLY_ADD_HPP
+#define FSLINALG_BASIC_LINALG_MULTIPLY_ADD_HPP
+
+#include <FSLinalg/Scalar.hpp>
+#include <FSLinalg/BasicLinalg/Product.hpp>
+
+#include <cmath>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+
+/*
+ * Computes c + op(a)*op(b), op conjugating its argument when requested.
+ * 
+ * Real floating point operands are contracted with std::fma, with a single rounding, whenever the target provides a 
+ * hardware fused multiply-add (FP_FAST_FMA, FP_FAST_FMAF, FP_FAST_FMAL). Otherwise a*b + c is left to the compiler. 
+ * 
+ * Complex operands go through std::complex arithmetic, which recovers from spurious overflows and NaNs. Defining
+ * FSLINALG_CPX_LIMITED_RANGE opts into the limited-range form, where each component is a chain of two real 
+ * multiply-adds.
+ */
+template<bool conjugateA, bool conjugateB>
+struct MultiplyAdd
+{
+	template<Scalar_concept A, Scalar_concept B, Scalar_concept C>
+	using ReturnType = decltype(std::declval<Product<conjugateA, conjugateB>>()(std::declval<A>(), std::declval<B>()) + std::declval<C>());
+	
+	template<Scalar_concept A, Scalar_concept B, Scalar_concept C>
+	constexpr ReturnType<A,B,C> operator()(const A& a, const B& b, const C& c) const;
+};
+
+template<RealScalar_concept T> constexpr T fusedMultiplyAdd(const T& a, const T& b, const T& c);
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/MultiplyAdd_impl.hpp>
+
+#endif // FSLINALG_BASIC_LINALG_MULTIPLY_ADD_HPP
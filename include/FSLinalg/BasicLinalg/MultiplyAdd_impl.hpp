@@ -0,0 +1,92 @@
+#ifndef FSLINALG_BASIC_LINALG_MULTIPLY_ADD_IMPL_HPP
+#define FSLINALG_BASIC_LINALG_MULTIPLY_ADD_IMPL_HPP
+
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+namespace detail
+{
+
+template<typename T> constexpr bool hasFastFma = false;
+
+#ifdef FP_FAST_FMAF
+template<> constexpr bool hasFastFma<float> = true;
+#endif
+#ifdef FP_FAST_FMA
+template<> constexpr bool hasFastFma<double> = true;
+#endif
+#ifdef FP_FAST_FMAL
+template<> constexpr bool hasFastFma<long double> = true;
+#endif
+
+} // namespace detail
+
+template<RealScalar_concept T> 
+constexpr T fusedMultiplyAdd(const T& a, const T& b, const T& c)
+{
+	if constexpr (detail::hasFastFma<T>)
+	{
+		if (not std::is_constant_evaluated()) { return std::fma(a, b, c); }
+	}
+	return a*b + c;
+}
+
+template<bool conjugateA, bool conjugateB> template<Scalar_concept A, Scalar_concept B, Scalar_concept C>
+constexpr auto MultiplyAdd<conjugateA,conjugateB>::operator()(const A& a, const B& b, const C& c) const -> ReturnType<A,B,C>
+{
+	using Return = ReturnType<A,B,C>;
+	using Real   = typename NumTraits<Return>::Real;
+	
+	constexpr bool isComplexA = IsComplexScalar<A>::value;
+	constexpr bool isComplexB = IsComplexScalar<B>::value;
+	constexpr bool isComplexC = IsComplexScalar<C>::value;
+	
+	if constexpr (not isComplexA and not isComplexB and not isComplexC)
+	{
+		if constexpr (std::floating_point<Return>) { return fusedMultiplyAdd<Return>(Return(a), Return(b), Return(c)); }
+		else                                       { return a*b + c; }
+	}
+	else if constexpr (not isComplexA and not isComplexB)
+	{
+		return Return(fusedMultiplyAdd<Real>(Real(a), Real(b), Real(real(c))), Real(imag(c)));
+	}
+#ifdef FSLINALG_CPX_LIMITED_RANGE
+	else if constexpr (isComplexA and isComplexB)
+	{
+		const Real ar = Real(real(a));
+		const Real ai = conjugateA ? Real(-imag(a)) : Real(imag(a));
+		const Real br = Real(real(b));
+		const Real bi = conjugateB ? Real(-imag(b)) : Real(imag(b));
+		
+		return Return(
+			fusedMultiplyAdd<Real>(ar, br, fusedMultiplyAdd<Real>(-ai, bi, Real(real(c)))),
+			fusedMultiplyAdd<Real>(ar, bi, fusedMultiplyAdd<Real>( ai, br, Real(imag(c)))));
+	}
+#endif
+	else if constexpr (not isComplexA)
+	{
+		const Real bi = conjugateB ? Real(-imag(b)) : Real(imag(b));
+		
+		return Return(fusedMultiplyAdd<Real>(Real(a), Real(real(b)), Real(real(c))), fusedMultiplyAdd<Real>(Real(a), bi, Real(imag(c))));
+	}
+	else if constexpr (not isComplexB)
+	{
+		const Real ai = conjugateA ? Real(-imag(a)) : Real(imag(a));
+		
+		return Return(fusedMultiplyAdd<Real>(Real(real(a)), Real(b), Real(real(c))), fusedMultiplyAdd<Real>(ai, Real(b), Real(imag(c))));
+	}
+	else
+	{
+		constexpr Product<conjugateA, conjugateB> prod;
+		
+		return prod(a, b) + c;
+	}
+}
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#endif // FSLINALG_BASIC_LINALG_MULTIPLY_ADD_IMPL_HPP
@@ -1,17 +1,19 @@
 #ifndef FSLINALG_NORM_HPP
 #define FSLINALG_NORM_HPP
 
-#include <FSLinalg/Vector/VectorBase.hpp>
-#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix.hpp>
+
+#include <cmath>
 
 namespace FSLinalg
 {
 
-template<typename Expr> typename Expr::RealScalar squaredNorm(const MatrixBase<Expr>& base_expr);
-template<typename Expr> typename Expr::RealScalar norm(const MatrixBase<Expr>& base_expr) { return std::sqrt(squaredNorm(base_expr)); }
+// Acc is the accumulator type, AccumulatorTraits<Expr::RealScalar>::Type by default
+template<typename Acc = void, typename Expr> AccumulatorType<Acc, typename Expr::RealScalar> squaredNorm(const MatrixBase<Expr>& base_expr);
+template<typename Acc = void, typename Expr> AccumulatorType<Acc, typename Expr::RealScalar> norm(const MatrixBase<Expr>& base_expr) { using std::sqrt; return sqrt(squaredNorm<Acc>(base_expr)); }
 
 } // namespace FSLinalg
 
-#include <FSLinalg/BasicLinalg/Norm.hpp>
+#include <FSLinalg/BasicLinalg/Norm_impl.hpp>
 
 #endif // FSLINALG_NORM_HPP
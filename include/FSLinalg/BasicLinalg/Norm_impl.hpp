@@ -2,60 +2,45 @@
 #define FSLINALG_NORM_IMPL_HPP
 
 #include <FSLinalg/BasicLinalg/Norm.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/BasicLinalg/Reduction.hpp>
 #include <FSLinalg/Scalar.hpp>
 
 namespace FSLinalg
 {
 
-template<typename Expr>
-typename Expr::RealScalar squaredNorm(const VectorBase<Expr>& base_expr)
+template<typename Acc, typename Expr>
+AccumulatorType<Acc, typename Expr::RealScalar> squaredNorm(const MatrixBase<Expr>& base_expr)
 {
-	using TmpExpr    = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, Vector<typename Expr::Scalar, Expr::size> >;
-	using Size       = typename Expr::Size;
-	using RealScalar = typename Expr::RealScalar;
+	using TmpExpr     = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, Matrix<typename Expr::Scalar, Expr::nRows, Expr::nCols> >;
+	using Size        = typename Expr::Size;
+	using Accumulator = AccumulatorType<Acc, typename Expr::RealScalar>;
+	using Promoted    = typename PromoteTraits<typename Expr::Scalar, Accumulator>::Type;
 	
-	TmpExpr expr(base_expr.derived());
-	
-	RealScalar res(0);
-	
-	for (Size i=0; i!=expr.size; ++i)
-	{
-		res += abs2(expr[i]);
-	}
-	
-	return res;
-}
-
-template<typename Expr>
-typename Expr::RealScalar squaredNorm(const MatrixBase<Expr>& base_expr)
-{
-	using TmpExpr    = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, MatrixBase<typename Expr::Scalar, Expr::nRows, Expr::nCols> >;
-	using Size       = typename Expr::Size;
-	using RealScalar = typename Expr::RealScalar;
+	constexpr BasicLinalg::MultiplyAdd<false,false> madd;
 	
 	TmpExpr expr(base_expr.derived());
 	
-	RealScalar res(0);
+	const auto update = [&](Accumulator& acc, const Promoted& x) -> void
+	{
+		if constexpr (IsComplexScalar<typename Expr::Scalar>::value) { acc = madd(real(x), real(x), madd(imag(x), imag(x), acc)); }
+		else                                                         { acc = madd(x, x, acc);                                     }
+	};
 	
-	if constexpr (expr.hasFlatRandomAccess)
+	if constexpr (std::decay_t<TmpExpr>::hasFlatRandomAccess)
 	{
-		for (Size i=0; i!=expr.size; ++i)
+		return BasicLinalg::Reduction<Expr::size>::template run<Accumulator>([&](Accumulator& acc, const Size i) -> void
 		{
-			res += abs2(expr[i]);
-		}
+			update(acc, static_cast<Promoted>(expr[i]));
+		});
 	}
 	else
 	{
-		for (Size i=0; i!=expr.nRows; ++i)
+		return BasicLinalg::Reduction<Expr::size>::template run<Accumulator>([&](Accumulator& acc, const Size i) -> void
 		{
-			for (Size j=0; j!=expr.nCols; ++j)
-			{
-				res += abs2(expr(i,j));
-			}
-		}
+			update(acc, static_cast<Promoted>(expr(i / Expr::nCols, i % Expr::nCols)));
+		});
 	}
-	
-	return res;
 }
 
 } // namespace FSLinalg
@@ -0,0 +1,55 @@
+#ifndef FSLINALG_PARTIAL_PIVOT_LU_HPP
+#define FSLINALG_PARTIAL_PIVOT_LU_HPP
+
+#include <FSLinalg/Matrix.hpp>
+
+#include <array>
+
+namespace FSLinalg
+{
+
+/*
+ * P*A = L*U with partial (row) pivoting, L being unit lower triangular. Both factors are stored in place in a single
+ * N x N matrix, no allocation takes place. A zero pivot marks the matrix as singular, solve must not be called then.
+ */
+template<typename T, unsigned int N>
+class PartialPivotLU
+{
+public:
+	using Scalar     = T;
+	using RealScalar = typename NumTraits<T>::Real;
+	using Size       = unsigned int;
+	
+	template<class Expr> 
+	explicit PartialPivotLU(const MatrixBase<Expr>& A) requires(Expr::nRows == N and Expr::nCols == N);
+	
+	bool isInvertible() const { return m_isInvertible; }
+	
+	Scalar determinant() const;
+	
+	// X such that A*X = B
+	template<class Expr> 
+	Matrix<Scalar, N, Expr::nCols> solve(const MatrixBase<Expr>& B) const requires(Expr::nRows == N);
+	
+	Matrix<Scalar, N, N> inverse() const;
+	
+	// L below the diagonal (unit diagonal omitted) and U on and above it
+	const Matrix<Scalar, N, N>& matrixLU() const { return m_lu; }
+	
+	// row i of P*A is row permutation()[i] of A
+	const std::array<Size, N>& permutation() const { return m_permutation; }
+private:
+	Matrix<Scalar, N, N> m_lu;
+	std::array<Size, N>  m_permutation;
+	bool                 m_isInvertible;
+	bool                 m_isOddPermutation;
+};
+
+template<class Expr> requires(Expr::nRows == Expr::nCols)
+PartialPivotLU<typename Expr::Scalar, Expr::nRows> lu(const MatrixBase<Expr>& A) { return PartialPivotLU<typename Expr::Scalar, Expr::nRows>(A); }
+
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/PartialPivotLU_impl.hpp>
+
+#endif // FSLINALG_PARTIAL_PIVOT_LU_HPP
@@ -0,0 +1,117 @@
+#ifndef FSLINALG_PARTIAL_PIVOT_LU_IMPL_HPP
+#define FSLINALG_PARTIAL_PIVOT_LU_IMPL_HPP
+
+#include <FSLinalg/BasicLinalg/PartialPivotLU.hpp>
+
+#include <cassert>
+#include <utility>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int N> template<class Expr> 
+PartialPivotLU<T,N>::PartialPivotLU(const MatrixBase<Expr>& A) requires(Expr::nRows == N and Expr::nCols == N) :
+	m_lu(A.derived()),
+	m_isInvertible(true),
+	m_isOddPermutation(false)
+{
+	for (Size i=0; i!=N; ++i) { m_permutation[i] = i; }
+	
+	for (Size k=0; k!=N; ++k)
+	{
+		Size       pivot    = k;
+		RealScalar pivotAbs = abs(m_lu(k,k));
+		for (Size i=k+1; i<N; ++i)
+		{
+			const RealScalar candidate = abs(m_lu(i,k));
+			if (candidate > pivotAbs)
+			{
+				pivot    = i;
+				pivotAbs = candidate;
+			}
+		}
+		
+		if (pivot != k)
+		{
+			for (Size j=0; j!=N; ++j) { std::swap(m_lu(k,j), m_lu(pivot,j)); }
+			std::swap(m_permutation[k], m_permutation[pivot]);
+			m_isOddPermutation = not m_isOddPermutation;
+		}
+		
+		if (pivotAbs == RealScalar(0))
+		{
+			m_isInvertible = false;
+			continue;
+		}
+		
+		const Scalar invPivot = RealScalar(1)/m_lu(k,k);
+		for (Size i=k+1; i<N; ++i)
+		{
+			const Scalar l = m_lu(i,k)*invPivot;
+			m_lu(i,k) = l;
+			for (Size j=k+1; j<N; ++j) { m_lu(i,j) -= l*m_lu(k,j); }
+		}
+	}
+}
+
+template<typename T, unsigned int N>
+auto PartialPivotLU<T,N>::determinant() const -> Scalar
+{
+	Scalar det = m_isOddPermutation ? Scalar(RealScalar(-1)) : Scalar(RealScalar(1));
+	for (Size i=0; i!=N; ++i) { det *= m_lu(i,i); }
+	return det;
+}
+
+template<typename T, unsigned int N> template<class Expr> 
+auto PartialPivotLU<T,N>::solve(const MatrixBase<Expr>& base_B) const -> Matrix<Scalar, N, Expr::nCols> requires(Expr::nRows == N)
+{
+	assert(m_isInvertible);
+	
+	constexpr Size M = Expr::nCols;
+	
+	const Matrix<typename Expr::Scalar, N, M> B(base_B.derived());
+	Matrix<Scalar, N, M> X(Scalar(RealScalar(0)));
+	
+	for (Size i=0; i!=N; ++i)
+	{
+		for (Size j=0; j!=M; ++j) { X(i,j) = B(m_permutation[i],j); }
+	}
+	
+	// L*Y = P*B
+	for (Size i=0; i!=N; ++i)
+	{
+		for (Size k=0; k!=i; ++k)
+		{
+			const Scalar l = m_lu(i,k);
+			for (Size j=0; j!=M; ++j) { X(i,j) -= l*X(k,j); }
+		}
+	}
+	
+	// U*X = Y
+	for (Size i=N; i--!=0;)
+	{
+		for (Size k=i+1; k<N; ++k)
+		{
+			const Scalar u = m_lu(i,k);
+			for (Size j=0; j!=M; ++j) { X(i,j) -= u*X(k,j); }
+		}
+		
+		const Scalar invPivot = RealScalar(1)/m_lu(i,i);
+		for (Size j=0; j!=M; ++j) { X(i,j) *= invPivot; }
+	}
+	
+	return X;
+}
+
+template<typename T, unsigned int N>
+auto PartialPivotLU<T,N>::inverse() const -> Matrix<Scalar, N, N>
+{
+	Matrix<Scalar, N, N> I(Scalar(RealScalar(0)));
+	for (Size i=0; i!=N; ++i) { I(i,i) = Scalar(RealScalar(1)); }
+	
+	return solve(I);
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_PARTIAL_PIVOT_LU_IMPL_HPP
@@ -0,0 +1,21 @@
+#ifndef FSLINALG_QUADRATIC_FORM_HPP
+#define FSLINALG_QUADRATIC_FORM_HPP
+
+#include <FSLinalg/Matrix.hpp>
+
+namespace FSLinalg
+{
+
+template<class X, class A, class Y>
+using QuadraticFormScalar = decltype(conj(std::declval<typename X::Scalar>()) * std::declval<typename A::Scalar>() * std::declval<typename Y::Scalar>());
+
+// Computes x^H * A * y without materializing A*y: each row of A is reduced against y into a scalar before being weighted by conj(x[i])
+// Acc is the accumulator type, AccumulatorTraits<QuadraticFormScalar<X,A,Y>>::Type by default
+template<typename Acc = void, class X, class A, class Y> 
+AccumulatorType< Acc, QuadraticFormScalar<X,A,Y> > quadForm(const MatrixBase<X>& base_x, const MatrixBase<A>& base_a, const MatrixBase<Y>& base_y) requires(X::isRowVector and Y::isRowVector);
+	
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/QuadraticForm_impl.hpp>
+
+#endif // FSLINALG_QUADRATIC_FORM_HPP
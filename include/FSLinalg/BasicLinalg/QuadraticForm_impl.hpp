@@ -0,0 +1,50 @@
+#ifndef FSLINALG_QUADRATIC_FORM_IMPL_HPP
+#define FSLINALG_QUADRATIC_FORM_IMPL_HPP
+
+#include <FSLinalg/Scalar.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/BasicLinalg/Reduction.hpp>
+#include <FSLinalg/BasicLinalg/QuadraticForm.hpp>
+
+namespace FSLinalg
+{
+
+template<typename Acc, class X, class A, class Y>
+AccumulatorType< Acc, QuadraticFormScalar<X,A,Y> > quadForm(const MatrixBase<X>& base_x, const MatrixBase<A>& base_a, const MatrixBase<Y>& base_y) requires(X::isRowVector and Y::isRowVector)
+{
+	static_assert(X::size == A::nRows, "Matrices sizes must match");
+	static_assert(Y::size == A::nCols, "Matrices sizes must match");
+	
+	using TmpX = std::conditional_t<X::hasFlatRandomAccess, const X&, RowVector<typename X::Scalar, X::size> >;
+	using TmpA = std::conditional_t<A::hasReadRandomAccess, const A&, Matrix<typename A::Scalar, A::nRows, A::nCols> >;
+	using TmpY = std::conditional_t<Y::hasFlatRandomAccess, const Y&, RowVector<typename Y::Scalar, Y::size> >;
+	
+	using Size        = typename A::Size;
+	using Accumulator = AccumulatorType< Acc, QuadraticFormScalar<X,A,Y> >;
+	using RealAcc     = typename NumTraits<Accumulator>::Real;
+	using XScalar     = typename PromoteTraits<typename X::Scalar, RealAcc>::Type;
+	using AScalar     = typename PromoteTraits<typename A::Scalar, RealAcc>::Type;
+	using YScalar     = typename PromoteTraits<typename Y::Scalar, RealAcc>::Type;
+	
+	constexpr BasicLinalg::MultiplyAdd<false,false> madd;
+	constexpr BasicLinalg::MultiplyAdd<true,false>  cmadd;
+	
+	TmpX x(base_x.derived());
+	TmpA a(base_a.derived());
+	TmpY y(base_y.derived());
+	
+	return BasicLinalg::Reduction<A::nRows>::template run<Accumulator>([&](Accumulator& acc, const Size i) -> void
+	{
+		Accumulator row(RealAcc(0));
+		for (Size j=0; j!=A::nCols; ++j)
+		{
+			row = static_cast<Accumulator>(madd(static_cast<AScalar>(a(i,j)), static_cast<YScalar>(y[j]), row));
+		}
+		
+		acc = static_cast<Accumulator>(cmadd(static_cast<XScalar>(x[i]), row, acc));
+	});
+}
+	
+} // namespace FSLinalg
+
+#endif // FSLINALG_QUADRATIC_FORM_IMPL_HPP
@@ -0,0 +1,50 @@
+#ifndef FSLINALG_BASIC_LINALG_RANK_UPDATE_HPP
+#define FSLINALG_BASIC_LINALG_RANK_UPDATE_HPP
+
+#include <FSLinalg/Scalar.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+
+/*
+ * Y = alpha * op(U) * op(V)^T (or Y += when incrDst), U being nRowsY x K and V nColsY x K, op conjugating when requested.
+ * 
+ * Meant for small K (outer products, U*V^T and J*J^T accumulations; transpose(J)*J products go through the general 
+ * kernel): the rows of Y are processed by blocks of blockRows, the K entries of each row of U are broadcast and every V 
+ * element loaded feeds blockRows independent multiply-adds.
+ * 
+ * runSymmetric computes Y (+)= alpha * U * U^H for a real alpha: only the upper triangle is reduced and its increments 
+ * are mirrored (conjugated) into the lower one.
+ */
+template<bool conjugateU, bool conjugateV, unsigned int nRowsY, unsigned int nColsY, unsigned int K, bool incrDst>
+struct RankUpdate
+{
+	using Size = unsigned int;
+	
+	static constexpr Size blockRows = 4;
+	
+	// GeneralMatrixMatrixProduct forwards U*transpose(V) products up to this inner dimension
+	static constexpr Size maxRank = 8;
+	
+	template<Scalar_concept ScalarAlpha, DenseMatrix_concept<nRowsY,K> DenseU, DenseMatrix_concept<nColsY,K> DenseV, DenseMatrix_concept<nRowsY,nColsY> DenseY>
+	static void run(const ScalarAlpha& alpha, const DenseU& U, const DenseV& V, DenseY& Y);
+	
+	template<RealScalar_concept ScalarAlpha, DenseMatrix_concept<nRowsY,K> DenseU, DenseMatrix_concept<nRowsY,nColsY> DenseY>
+	static void runSymmetric(const ScalarAlpha& alpha, const DenseU& U, DenseY& Y) requires(nRowsY == nColsY);
+private:
+	template<Size rows, bool symmetric, Scalar_concept ScalarAlpha, Scalar_concept ScalarU, Scalar_concept ScalarV, Scalar_concept ScalarY>
+	static void block(const ScalarAlpha& alpha, const ScalarU* u, const ScalarV* v, ScalarY* y, const Size i0);
+	
+	template<bool symmetric, Scalar_concept ScalarAlpha, Scalar_concept ScalarU, Scalar_concept ScalarV, Scalar_concept ScalarY>
+	static void blocks(const ScalarAlpha& alpha, const ScalarU* u, const ScalarV* v, ScalarY* y);
+};
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/RankUpdate_impl.hpp>
+
+#endif // FSLINALG_BASIC_LINALG_RANK_UPDATE_HPP
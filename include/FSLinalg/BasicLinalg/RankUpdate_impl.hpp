@@ -0,0 +1,136 @@
+#ifndef FSLINALG_BASIC_LINALG_RANK_UPDATE_IMPL_HPP
+#define FSLINALG_BASIC_LINALG_RANK_UPDATE_IMPL_HPP
+
+#include <FSLinalg/BasicLinalg/RankUpdate.hpp>
+#include <FSLinalg/BasicLinalg/Product.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/misc/Restrict.hpp>
+
+#include <array>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+
+template<bool conjugateU, bool conjugateV, unsigned int nRowsY, unsigned int nColsY, unsigned int K, bool incrDst>
+template<unsigned int rows, bool symmetric, Scalar_concept ScalarAlpha, Scalar_concept ScalarU, Scalar_concept ScalarV, Scalar_concept ScalarY>
+void RankUpdate<conjugateU,conjugateV,nRowsY,nColsY,K,incrDst>::block(const ScalarAlpha& alpha, const ScalarU* u, const ScalarV* v, ScalarY* y, const Size i0)
+{
+	using Accumulator = typename AccumulatorTraits< typename MultiplyAdd<false, conjugateV>::template ReturnType<decltype(std::declval<ScalarAlpha>()*std::declval<ScalarU>()), ScalarV, ScalarY> >::Type;
+	using ScaledU     = typename PromoteTraits< decltype(std::declval<ScalarAlpha>()*std::declval<ScalarU>()), typename NumTraits<Accumulator>::Real >::Type;
+	
+	constexpr Product    <false, conjugateU> prodU;
+	constexpr MultiplyAdd<false, conjugateV> maddV;
+	
+	// the symmetric update only reduces the columns right of the diagonal block
+	const Size j0 = symmetric ? i0 : 0;
+	
+	// symmetric updates accumulate increments, which are added to both triangles on store
+	std::array<Accumulator, rows*nColsY> acc;
+	
+	for (Size r=0; r!=rows; ++r)
+	{
+		for (Size j=j0; j!=nColsY; ++j)
+		{
+			if constexpr (incrDst and not symmetric) { acc[r*nColsY + j] = static_cast<Accumulator>(y[(i0 + r)*nColsY + j]); }
+			else                                     { acc[r*nColsY + j] = Accumulator(0);                                    }
+		}
+	}
+	
+	for (Size k=0; k!=K; ++k)
+	{
+		std::array<ScaledU, rows> alphaU;
+		for (Size r=0; r!=rows; ++r) { alphaU[r] = static_cast<ScaledU>(prodU(alpha, u[(i0 + r)*K + k])); }
+		
+		for (Size j=j0; j!=nColsY; ++j)
+		{
+			const ScalarV vjk = v[j*K + k];
+			for (Size r=0; r!=rows; ++r)
+			{
+				acc[r*nColsY + j] = static_cast<Accumulator>(maddV(alphaU[r], vjk, acc[r*nColsY + j]));
+			}
+		}
+	}
+	
+	for (Size r=0; r!=rows; ++r)
+	{
+		const Size i = i0 + r;
+		
+		if constexpr (symmetric)
+		{
+			for (Size j=i; j!=nColsY; ++j)
+			{
+				const Accumulator& delta = acc[r*nColsY + j];
+				if constexpr (incrDst)
+				{
+					y[i*nColsY + j] = static_cast<ScalarY>(static_cast<Accumulator>(y[i*nColsY + j]) + delta);
+					if (j != i) { y[j*nColsY + i] = static_cast<ScalarY>(static_cast<Accumulator>(y[j*nColsY + i]) + conj(delta)); }
+				}
+				else
+				{
+					y[i*nColsY + j] = static_cast<ScalarY>(delta);
+					if (j != i) { y[j*nColsY + i] = static_cast<ScalarY>(conj(delta)); }
+				}
+			}
+		}
+		else
+		{
+			for (Size j=0; j!=nColsY; ++j) { y[i*nColsY + j] = static_cast<ScalarY>(acc[r*nColsY + j]); }
+		}
+	}
+}
+
+template<bool conjugateU, bool conjugateV, unsigned int nRowsY, unsigned int nColsY, unsigned int K, bool incrDst>
+template<bool symmetric, Scalar_concept ScalarAlpha, Scalar_concept ScalarU, Scalar_concept ScalarV, Scalar_concept ScalarY>
+void RankUpdate<conjugateU,conjugateV,nRowsY,nColsY,K,incrDst>::blocks(const ScalarAlpha& alpha, const ScalarU* u, const ScalarV* v, ScalarY* y)
+{
+	constexpr Size nFullBlocks = nRowsY / blockRows;
+	constexpr Size tailRows    = nRowsY % blockRows;
+	
+	for (Size b=0; b!=nFullBlocks; ++b)
+	{
+		block<blockRows, symmetric>(alpha, u, v, y, b*blockRows);
+	}
+	
+	if constexpr (tailRows != 0)
+	{
+		block<tailRows, symmetric>(alpha, u, v, y, nFullBlocks*blockRows);
+	}
+}
+
+template<bool conjugateU, bool conjugateV, unsigned int nRowsY, unsigned int nColsY, unsigned int K, bool incrDst>
+template<Scalar_concept ScalarAlpha, DenseMatrix_concept<nRowsY,K> DenseU, DenseMatrix_concept<nColsY,K> DenseV, DenseMatrix_concept<nRowsY,nColsY> DenseY>
+void RankUpdate<conjugateU,conjugateV,nRowsY,nColsY,K,incrDst>::run(
+	const ScalarAlpha& alpha, 
+	const DenseU&      U, 
+	const DenseV&      V, 
+	      DenseY&      Y)
+{
+	// callers never pass a Y read by U or V
+	const typename DenseU::Scalar* FSLINALG_RESTRICT u = U.data();
+	const typename DenseV::Scalar* FSLINALG_RESTRICT v = V.data();
+	      typename DenseY::Scalar* FSLINALG_RESTRICT y = Y.data();
+	
+	blocks<false>(alpha, u, v, y);
+}
+
+template<bool conjugateU, bool conjugateV, unsigned int nRowsY, unsigned int nColsY, unsigned int K, bool incrDst>
+template<RealScalar_concept ScalarAlpha, DenseMatrix_concept<nRowsY,K> DenseU, DenseMatrix_concept<nRowsY,nColsY> DenseY>
+void RankUpdate<conjugateU,conjugateV,nRowsY,nColsY,K,incrDst>::runSymmetric(
+	const ScalarAlpha& alpha, 
+	const DenseU&      U, 
+	      DenseY&      Y) requires(nRowsY == nColsY)
+{
+	static_assert(not conjugateU and (conjugateV or not IsComplexScalar<typename DenseU::Scalar>::value), "The symmetric update computes U*U^H");
+	
+	const typename DenseU::Scalar* FSLINALG_RESTRICT u = U.data();
+	      typename DenseY::Scalar* FSLINALG_RESTRICT y = Y.data();
+	
+	blocks<true>(alpha, u, u, y);
+}
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#endif // FSLINALG_BASIC_LINALG_RANK_UPDATE_IMPL_HPP
@@ -0,0 +1,39 @@
+#ifndef FSLINALG_BASIC_LINALG_REDUCTION_HPP
+#define FSLINALG_BASIC_LINALG_REDUCTION_HPP
+
+#include <FSLinalg/misc/BinaryOp.hpp>
+
+#include <array>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+
+/*
+ * Reduces the terms 0, ..., size-1 into nAccumulators independent partial results (term i goes to i % nAccumulators),
+ * which breaks the loop-carried dependency, then combines the partial results pairwise along a fixed tree. 
+ * The combine order only depends on size and nAccumulators, so results are reproducible whatever the vectorization.
+ */
+template<unsigned int size, unsigned int nAccumulators = 8>
+struct Reduction
+{
+	using Size = unsigned int;
+	
+	static_assert(nAccumulators > 0 and (nAccumulators & (nAccumulators - 1)) == 0, "The number of accumulators must be a power of two");
+	
+	// update(acc, i) accumulates the i-th term into acc
+	template<typename Acc, class Update>
+	static constexpr Acc run(const Update& update) { return run(update, Acc(0), BinaryOp::Add{}); }
+	
+	// same with partial results starting from init and combined with combine(a, b), for reductions other than sums
+	template<typename Acc, class Update, class Combine>
+	static constexpr Acc run(const Update& update, const Acc& init, const Combine& combine);
+};
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#include <FSLinalg/BasicLinalg/Reduction_impl.hpp>
+
+#endif // FSLINALG_BASIC_LINALG_REDUCTION_HPP
@@ -0,0 +1,37 @@
+#ifndef FSLINALG_BASIC_LINALG_REDUCTION_IMPL_HPP
+#define FSLINALG_BASIC_LINALG_REDUCTION_IMPL_HPP
+
+#include <FSLinalg/BasicLinalg/Reduction.hpp>
+
+namespace FSLinalg
+{
+namespace BasicLinalg
+{
+
+template<unsigned int size, unsigned int nAccumulators> template<typename Acc, class Update, class Combine>
+constexpr Acc Reduction<size, nAccumulators>::run(const Update& update, const Acc& init, const Combine& combine)
+{
+	constexpr Size nBlocks = size / nAccumulators;
+	constexpr Size nTail   = size % nAccumulators;
+	
+	std::array<Acc, nAccumulators> acc;
+	acc.fill(init);
+	
+	for (Size b=0; b!=nBlocks; ++b)
+	{
+		for (Size k=0; k!=nAccumulators; ++k) { update(acc[k], b*nAccumulators + k); }
+	}
+	for (Size k=0; k!=nTail; ++k) { update(acc[k], nBlocks*nAccumulators + k); }
+	
+	for (Size stride=1; stride!=nAccumulators; stride*=2)
+	{
+		for (Size k=0; k+stride<nAccumulators; k+=2*stride) { acc[k] = combine(acc[k], acc[k+stride]); }
+	}
+	
+	return acc[0];
+}
+
+} //namespace BasicLinalg
+} // namespace FSLinalg
+
+#endif // FSLINALG_BASIC_LINALG_REDUCTION_IMPL_HPP
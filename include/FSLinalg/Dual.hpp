@@ -0,0 +1,134 @@
+#ifndef FSLINALG_DUAL_HPP
+#define FSLINALG_DUAL_HPP
+
+#include <FSLinalg/Scalar.hpp>
+#include <FSLinalg/Matrix.hpp>
+
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <limits>
+
+#include <fmt/core.h>
+
+namespace FSLinalg
+{
+
+/*
+ * Forward mode automatic differentiation scalar: a value and its derivatives with respect to N variables.
+ * The derivative lanes are stored contiguously so that every operation is a short loop over N that the compiler vectorizes.
+ * Dual is a real scalar (NumTraits<Dual>::Real is Dual), so matrices and tensors of Dual go through the usual kernels
+ * and compute the value and the gradient in one pass. The type is structural so that it can be used as a template argument.
+ */
+template<std::floating_point T, unsigned int N>
+struct Dual
+{
+	using Size = unsigned int;
+	using Grad = std::array<T, N>;
+	
+	T    value;
+	Grad grad;
+	
+	constexpr Dual()                                      : value(0),       grad{}       {}
+	constexpr Dual(const T& a_value)                      : value(a_value), grad{}       {}
+	constexpr Dual(const T& a_value, const Grad& a_grad)  : value(a_value), grad(a_grad) {}
+	
+	// the variable number lane, with value a_value
+	static constexpr Dual variable(const T& a_value, const Size lane) { Dual ret(a_value); ret.grad[lane] = T(1); return ret; }
+	
+	friend constexpr bool operator==(const Dual& a, const Dual& b) = default;
+	
+	// comparisons only look at the value
+	friend constexpr bool operator< (const Dual& a, const Dual& b) { return a.value <  b.value; }
+	friend constexpr bool operator> (const Dual& a, const Dual& b) { return a.value >  b.value; }
+	friend constexpr bool operator<=(const Dual& a, const Dual& b) { return a.value <= b.value; }
+	friend constexpr bool operator>=(const Dual& a, const Dual& b) { return a.value >= b.value; }
+	
+	friend constexpr Dual operator-(const Dual& a) { return chain(a, -a.value, T(-1)); }
+	
+	friend constexpr Dual operator+(const Dual& a, const Dual& b) { Dual ret(a.value + b.value); for (Size k=0; k!=N; ++k) { ret.grad[k] = a.grad[k] + b.grad[k]; } return ret; }
+	friend constexpr Dual operator-(const Dual& a, const Dual& b) { Dual ret(a.value - b.value); for (Size k=0; k!=N; ++k) { ret.grad[k] = a.grad[k] - b.grad[k]; } return ret; }
+	friend constexpr Dual operator*(const Dual& a, const Dual& b) { Dual ret(a.value * b.value); for (Size k=0; k!=N; ++k) { ret.grad[k] = a.grad[k]*b.value + a.value*b.grad[k]; } return ret; }
+	friend constexpr Dual operator/(const Dual& a, const Dual& b) 
+	{ 
+		const T inv = T(1)/b.value;
+		Dual ret(a.value*inv); 
+		for (Size k=0; k!=N; ++k) { ret.grad[k] = (a.grad[k] - ret.value*b.grad[k])*inv; } 
+		return ret; 
+	}
+	
+	friend constexpr Dual operator+(const Dual& a, const T& b) { Dual ret(a); ret.value += b; return ret; }
+	friend constexpr Dual operator+(const T& a, const Dual& b) { return b + a; }
+	friend constexpr Dual operator-(const Dual& a, const T& b) { Dual ret(a); ret.value -= b; return ret; }
+	friend constexpr Dual operator-(const T& a, const Dual& b) { return chain(b, a - b.value, T(-1)); }
+	friend constexpr Dual operator*(const Dual& a, const T& b) { return chain(a, a.value*b, b); }
+	friend constexpr Dual operator*(const T& a, const Dual& b) { return chain(b, a*b.value, a); }
+	friend constexpr Dual operator/(const Dual& a, const T& b) { return chain(a, a.value/b, T(1)/b); }
+	friend constexpr Dual operator/(const T& a, const Dual& b) { const T ret = a/b.value; return chain(b, ret, -ret/b.value); }
+	
+	constexpr Dual& operator+=(const Dual& other) { return *this = *this + other; }
+	constexpr Dual& operator-=(const Dual& other) { return *this = *this - other; }
+	constexpr Dual& operator*=(const Dual& other) { return *this = *this * other; }
+	constexpr Dual& operator/=(const Dual& other) { return *this = *this / other; }
+	
+	friend Dual abs (const Dual& a) { return (a.value < T(0)) ? -a : a; }
+	friend Dual sqrt(const Dual& a) { const T ret = std::sqrt(a.value); return chain(a, ret, T(0.5)/ret); }
+	friend Dual exp (const Dual& a) { const T ret = std::exp (a.value); return chain(a, ret, ret); }
+	friend Dual log (const Dual& a) { return chain(a, std::log(a.value), T(1)/a.value); }
+	friend Dual sin (const Dual& a) { return chain(a, std::sin(a.value),  std::cos(a.value)); }
+	friend Dual cos (const Dual& a) { return chain(a, std::cos(a.value), -std::sin(a.value)); }
+	friend Dual pow (const Dual& a, const T& p) { const T ret = std::pow(a.value, p); return chain(a, ret, p*std::pow(a.value, p - T(1))); }
+private:
+	// f(a) knowing f(a.value) and f'(a.value)
+	static constexpr Dual chain(const Dual& a, const T& f, const T& df) { Dual ret(f); for (Size k=0; k!=N; ++k) { ret.grad[k] = df*a.grad[k]; } return ret; }
+};
+
+template<std::floating_point T, unsigned int N>
+struct NumTraits< Dual<T,N> >
+{
+	using Real = Dual<T,N>;
+	
+	static constexpr bool isComplex = false;
+	static constexpr Real epsilon   = Real(std::numeric_limits<T>::epsilon());
+	static constexpr Real max       = Real(std::numeric_limits<T>::max());
+	static constexpr Real min       = Real(std::numeric_limits<T>::min());
+	static constexpr Real infinity  = Real(std::numeric_limits<T>::infinity());
+};
+
+template<typename T>                             struct IsDual              : BIC::Fixed<bool, false> {};
+template<std::floating_point T, unsigned int N> struct IsDual< Dual<T,N> > : BIC::Fixed<bool, true>  {};
+
+// x as Dual<T,N> variables, x[i] being the variable number firstLane + i
+template<unsigned int N, std::floating_point T, unsigned int Nrows, unsigned int Ncols>
+Matrix<Dual<T,N>, Nrows, Ncols> makeVariables(const Matrix<T, Nrows, Ncols>& x, const unsigned int firstLane = 0);
+
+// values of a matrix expression of Dual
+template<class Expr> requires(IsDual<typename Expr::Scalar>::value)
+auto values(const MatrixBase<Expr>& expr);
+
+// derivatives of a matrix expression of Dual, one row per (row major) entry and one column per variable
+template<class Expr> requires(IsDual<typename Expr::Scalar>::value)
+auto jacobian(const MatrixBase<Expr>& expr);
+
+} // namespace FSLinalg
+
+template<std::floating_point T, unsigned int N>
+struct fmt::formatter< FSLinalg::Dual<T,N> > : fmt::formatter<T>
+{
+	template <typename Context>
+	auto format(const FSLinalg::Dual<T,N>& x, Context& ctx) const 
+	{ 
+		auto out = fmt::formatter<T>::format(x.value, ctx);
+		for (unsigned int k=0; k!=N; ++k)
+		{
+			out = (k == 0) ? fmt::format_to(out, " [") : fmt::format_to(out, ", ");
+			ctx.advance_to(out);
+			out = fmt::formatter<T>::format(x.grad[k], ctx);
+		}
+		return (N == 0) ? out : fmt::format_to(out, "]");
+	}
+};
+
+#include <FSLinalg/Dual_impl.hpp>
+
+#endif // FSLINALG_DUAL_HPP
@@ -0,0 +1,54 @@
+#ifndef FSLINALG_DUAL_IMPL_HPP
+#define FSLINALG_DUAL_IMPL_HPP
+
+#include <FSLinalg/Dual.hpp>
+
+#include <cassert>
+
+namespace FSLinalg
+{
+
+template<unsigned int N, std::floating_point T, unsigned int Nrows, unsigned int Ncols>
+Matrix<Dual<T,N>, Nrows, Ncols> makeVariables(const Matrix<T, Nrows, Ncols>& x, const unsigned int firstLane)
+{
+	assert(firstLane + Nrows*Ncols <= N);
+	
+	Matrix<Dual<T,N>, Nrows, Ncols> ret;
+	for (unsigned int i=0; i!=Nrows*Ncols; ++i) { ret[i] = Dual<T,N>::variable(x[i], firstLane + i); }
+	return ret;
+}
+
+template<class Expr> requires(IsDual<typename Expr::Scalar>::value)
+auto values(const MatrixBase<Expr>& expr)
+{
+	using Scalar = typename Expr::Scalar;
+	using T      = decltype(Scalar::value);
+	
+	const Matrix<Scalar, Expr::nRows, Expr::nCols> tmp(expr.derived());
+	
+	Matrix<T, Expr::nRows, Expr::nCols> ret;
+	for (unsigned int i=0; i!=Expr::size; ++i) { ret[i] = tmp[i].value; }
+	return ret;
+}
+
+template<class Expr> requires(IsDual<typename Expr::Scalar>::value)
+auto jacobian(const MatrixBase<Expr>& expr)
+{
+	using Scalar = typename Expr::Scalar;
+	using T      = decltype(Scalar::value);
+	
+	constexpr unsigned int N = std::tuple_size<typename Scalar::Grad>::value;
+	
+	const Matrix<Scalar, Expr::nRows, Expr::nCols> tmp(expr.derived());
+	
+	Matrix<T, Expr::size, N> ret;
+	for (unsigned int i=0; i!=Expr::size; ++i) 
+	{ 
+		for (unsigned int k=0; k!=N; ++k) { ret(i,k) = tmp[i].grad[k]; }
+	}
+	return ret;
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_DUAL_IMPL_HPP
@@ -0,0 +1,3 @@
+#include <FSLinalg/Geometry/Quaternion.hpp>
+#include <FSLinalg/Geometry/Rotation3.hpp>
+#include <FSLinalg/Geometry/LieGroup.hpp>
@@ -0,0 +1,42 @@
+#ifndef FSLINALG_LIE_GROUP_HPP
+#define FSLINALG_LIE_GROUP_HPP
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Geometry/Quaternion.hpp>
+#include <FSLinalg/Geometry/Rotation3.hpp>
+#include <FSLinalg/BasicLinalg/MatrixExponential.hpp>
+
+#include <concepts>
+
+namespace FSLinalg
+{
+
+/*
+ * Closed forms of the exponential and logarithm maps of SO(3) and SE(3) (Rodrigues' formula), switching to Taylor 
+ * expansions of the coefficients close to the identity.
+ */
+
+// exp([omega]x), the rotation of angle |omega| around omega
+template<class Expr> requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector) and std::floating_point<typename Expr::Scalar>)
+Matrix<typename Expr::Scalar, 3, 3> expSO3(const MatrixBase<Expr>& omega);
+
+// skew matrices go through Rodrigues' formula rather than scaling and squaring
+template<std::floating_point T> Matrix<T, 3, 3> exp(const SkewMatrix<T>& K) { return expSO3(K.vector()); }
+
+// exp of the twist (omega, v) as a 4x4 homogeneous transform [R t; 0 1]
+template<class ExprW, class ExprV> 
+	requires(ExprW::size == 3 and (ExprW::isRowVector or ExprW::isColVector) and ExprV::size == 3 and (ExprV::isRowVector or ExprV::isColVector) and std::floating_point<typename ExprW::Scalar>)
+Matrix<typename ExprW::Scalar, 4, 4> expSE3(const MatrixBase<ExprW>& omega, const MatrixBase<ExprV>& v);
+
+// rotation vector omega such that exp([omega]x) = R, with |omega| in [0, pi]
+template<std::floating_point T> RowVector<T, 3> log(const Quaternion<T>& q);
+template<std::floating_point T> RowVector<T, 3> log(const Rotation3<T>& R) { return log(R.quaternion()); }
+
+template<class Expr> requires(Expr::nRows == 3 and Expr::nCols == 3 and std::floating_point<typename Expr::Scalar>)
+RowVector<typename Expr::Scalar, 3> logSO3(const MatrixBase<Expr>& R) { return log(Quaternion<typename Expr::Scalar>::fromMatrix(R)); }
+
+} // namespace FSLinalg
+
+#include <FSLinalg/Geometry/LieGroup_impl.hpp>
+
+#endif // FSLINALG_LIE_GROUP_HPP
@@ -0,0 +1,132 @@
+#ifndef FSLINALG_LIE_GROUP_IMPL_HPP
+#define FSLINALG_LIE_GROUP_IMPL_HPP
+
+#include <FSLinalg/Geometry/LieGroup.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+// sin(theta)/theta, (1 - cos(theta))/theta^2 and (theta - sin(theta))/theta^3
+template<std::floating_point T>
+struct RodriguesCoefficients
+{
+	T a;
+	T b;
+	T c;
+	
+	explicit RodriguesCoefficients(const T& theta2)
+	{
+		if (theta2 < std::sqrt(std::numeric_limits<T>::epsilon()))
+		{
+			a = T(1)    - theta2*(T(1)/T(6)   - theta2/T(120));
+			b = T(0.5)  - theta2*(T(1)/T(24)  - theta2/T(720));
+			c = T(1)/T(6) - theta2*(T(1)/T(120) - theta2/T(5040));
+		}
+		else
+		{
+			const T theta = std::sqrt(theta2);
+			const T sin   = std::sin(theta);
+			a = sin/theta;
+			b = (T(1) - std::cos(theta))/theta2;
+			c = (theta - sin)/(theta2*theta);
+		}
+	}
+};
+
+// I + alpha [w]x + beta [w]x^2, using [w]x^2 = w w^T - |w|^2 I
+template<std::floating_point T>
+Matrix<T, 3, 3> rodrigues(const RowVector<T, 3>& w, const T& theta2, const T& alpha, const T& beta)
+{
+	Matrix<T, 3, 3> ret(T(0));
+	for (unsigned int i=0; i!=3; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j) { ret(i,j) = beta*w[i]*w[j]; }
+		ret(i,i) += T(1) - beta*theta2;
+	}
+	
+	ret(0,1) -= alpha*w[2]; ret(1,0) += alpha*w[2];
+	ret(0,2) += alpha*w[1]; ret(2,0) -= alpha*w[1];
+	ret(1,2) -= alpha*w[0]; ret(2,1) += alpha*w[0];
+	
+	return ret;
+}
+
+} // namespace detail
+
+template<class Expr> requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector) and std::floating_point<typename Expr::Scalar>)
+Matrix<typename Expr::Scalar, 3, 3> expSO3(const MatrixBase<Expr>& base_omega)
+{
+	using T = typename Expr::Scalar;
+	
+	const Matrix<T, Expr::nRows, Expr::nCols> tmp(base_omega.derived());
+	const RowVector<T, 3> w({tmp[0], tmp[1], tmp[2]});
+	
+	const T theta2 = w[0]*w[0] + w[1]*w[1] + w[2]*w[2];
+	const detail::RodriguesCoefficients<T> coeffs(theta2);
+	
+	return detail::rodrigues(w, theta2, coeffs.a, coeffs.b);
+}
+
+template<class ExprW, class ExprV> 
+	requires(ExprW::size == 3 and (ExprW::isRowVector or ExprW::isColVector) and ExprV::size == 3 and (ExprV::isRowVector or ExprV::isColVector) and std::floating_point<typename ExprW::Scalar>)
+Matrix<typename ExprW::Scalar, 4, 4> expSE3(const MatrixBase<ExprW>& base_omega, const MatrixBase<ExprV>& base_v)
+{
+	using T = typename ExprW::Scalar;
+	
+	const Matrix<T, ExprW::nRows, ExprW::nCols> tmpW(base_omega.derived());
+	const Matrix<T, ExprV::nRows, ExprV::nCols> tmpV(base_v.derived());
+	const RowVector<T, 3> w({tmpW[0], tmpW[1], tmpW[2]});
+	const RowVector<T, 3> v({tmpV[0], tmpV[1], tmpV[2]});
+	
+	const T theta2 = w[0]*w[0] + w[1]*w[1] + w[2]*w[2];
+	const detail::RodriguesCoefficients<T> coeffs(theta2);
+	
+	// R = I + a [w]x + b [w]x^2 and t = (I + b [w]x + c [w]x^2) v
+	const Matrix<T, 3, 3> R = detail::rodrigues(w, theta2, coeffs.a, coeffs.b);
+	const Matrix<T, 3, 3> J = detail::rodrigues(w, theta2, coeffs.b, coeffs.c);
+	const RowVector<T, 3> t = J*v;
+	
+	Matrix<T, 4, 4> ret(T(0));
+	for (unsigned int i=0; i!=3; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j) { ret(i,j) = R(i,j); }
+		ret(i,3) = t[i];
+	}
+	ret(3,3) = T(1);
+	
+	return ret;
+}
+
+template<std::floating_point T> 
+RowVector<T, 3> log(const Quaternion<T>& base_q)
+{
+	// q and -q are the same rotation, w >= 0 gives the angle in [0, pi]
+	const Quaternion<T> q = (base_q.w < T(0)) ? -base_q : base_q;
+	
+	const T n2 = q.x*q.x + q.y*q.y + q.z*q.z;
+	const T n  = std::sqrt(n2);
+	
+	// omega = 2 atan2(n, w)/n * (x, y, z), expanded around n = 0
+	T scale;
+	if (n2 < std::sqrt(std::numeric_limits<T>::epsilon()))
+	{
+		const T w2 = q.w*q.w;
+		scale = (T(2)/q.w)*(T(1) - n2/(T(3)*w2));
+	}
+	else
+	{
+		scale = T(2)*std::atan2(n, q.w)/n;
+	}
+	
+	return RowVector<T, 3>({scale*q.x, scale*q.y, scale*q.z});
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_LIE_GROUP_IMPL_HPP
@@ -0,0 +1,120 @@
+#ifndef FSLINALG_QUATERNION_HPP
+#define FSLINALG_QUATERNION_HPP
+
+#include <FSLinalg/Matrix.hpp>
+
+#include <concepts>
+#include <span>
+
+#include <fmt/core.h>
+
+namespace FSLinalg
+{
+
+/*
+ * Quaternion w + x*i + y*j + z*k. Unit quaternions represent rotations with 4 scalars instead of 9, 
+ * compose with 16 multiplications instead of 27 and are renormalized with a single square root.
+ */
+template<std::floating_point T>
+struct Quaternion
+{
+	using Vector = RowVector<T, 3>;
+	
+	T w;
+	T x;
+	T y;
+	T z;
+	
+	constexpr Quaternion() : w(1), x(0), y(0), z(0) {}
+	constexpr Quaternion(const T& a_w, const T& a_x, const T& a_y, const T& a_z) : w(a_w), x(a_x), y(a_y), z(a_z) {}
+	
+	static constexpr Quaternion identity() { return Quaternion(); }
+	
+	// rotation of angle radians around axis (which does not need to be normalized)
+	template<class Expr> 
+	static Quaternion fromAxisAngle(const MatrixBase<Expr>& axis, const T& angle) requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector));
+	
+	// rotation matrix to unit quaternion (Shepperd's method, pivoting on the largest diagonal term)
+	template<class Expr> 
+	static Quaternion fromMatrix(const MatrixBase<Expr>& m) requires(Expr::nRows == 3 and Expr::nCols == 3);
+	
+	friend constexpr bool operator==(const Quaternion& a, const Quaternion& b) = default;
+	
+	friend constexpr Quaternion operator-(const Quaternion& a) { return Quaternion(-a.w, -a.x, -a.y, -a.z); }
+	
+	friend constexpr Quaternion operator+(const Quaternion& a, const Quaternion& b) { return Quaternion(a.w + b.w, a.x + b.x, a.y + b.y, a.z + b.z); }
+	friend constexpr Quaternion operator-(const Quaternion& a, const Quaternion& b) { return Quaternion(a.w - b.w, a.x - b.x, a.y - b.y, a.z - b.z); }
+	friend constexpr Quaternion operator*(const T& s, const Quaternion& a)          { return Quaternion(s*a.w, s*a.x, s*a.y, s*a.z);                 }
+	friend constexpr Quaternion operator*(const Quaternion& a, const T& s)          { return s*a;                                                    }
+	
+	// Hamilton product, a*b rotates by b then by a
+	friend constexpr Quaternion operator*(const Quaternion& a, const Quaternion& b)
+	{
+		return Quaternion(
+			a.w*b.w - a.x*b.x - a.y*b.y - a.z*b.z,
+			a.w*b.x + a.x*b.w + a.y*b.z - a.z*b.y,
+			a.w*b.y - a.x*b.z + a.y*b.w + a.z*b.x,
+			a.w*b.z + a.x*b.y - a.y*b.x + a.z*b.w);
+	}
+	
+	constexpr Quaternion& operator*=(const Quaternion& other) { return *this = *this * other; }
+	
+	constexpr T squaredNorm() const { return w*w + x*x + y*y + z*z; }
+	          T norm()        const { return std::sqrt(squaredNorm()); }
+	
+	Quaternion normalized() const { return (T(1)/norm())*(*this); }
+	
+	constexpr Quaternion conjugate() const { return Quaternion(w, -x, -y, -z); }
+	constexpr Quaternion inverse()   const { return (T(1)/squaredNorm())*conjugate(); }
+	
+	// rotation matrix of a unit quaternion
+	Matrix<T, 3, 3> toMatrix() const;
+	
+	// v rotated by a unit quaternion, as v + w*t + (x,y,z) x t with t = 2*(x,y,z) x v
+	template<class Expr>
+	Vector rotate(const MatrixBase<Expr>& v) const requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector));
+};
+
+template<std::floating_point T> constexpr T dot(const Quaternion<T>& a, const Quaternion<T>& b) { return a.w*b.w + a.x*b.x + a.y*b.y + a.z*b.z; }
+
+// normalized linear interpolation along the shortest path, cheap and accurate for close orientations
+template<std::floating_point T> Quaternion<T> nlerp(const Quaternion<T>& a, const Quaternion<T>& b, const T& t);
+
+// spherical linear interpolation along the shortest path (constant angular velocity), falls back on nlerp for close orientations
+template<std::floating_point T> Quaternion<T> slerp(const Quaternion<T>& a, const Quaternion<T>& b, const T& t);
+
+// out[p] = q applied to in[p], q is converted to a rotation matrix once so that each vector costs a 3x3 product
+template<std::floating_point T> 
+void rotate(const Quaternion<T>& q, std::span<const RowVector<T,3>> in, std::span<RowVector<T,3>> out);
+
+// out[p] = q[p] applied to in[p] as v + w*t + (x,y,z) x t with t = 2*(x,y,z) x v, without forming a matrix
+template<std::floating_point T> 
+void rotate(std::span<const Quaternion<T>> q, std::span<const RowVector<T,3>> in, std::span<RowVector<T,3>> out);
+
+} // namespace FSLinalg
+
+template<std::floating_point T>
+struct fmt::formatter< FSLinalg::Quaternion<T> > : fmt::formatter<T>
+{
+	template <typename Context>
+	auto format(const FSLinalg::Quaternion<T>& q, Context& ctx) const 
+	{ 
+		auto out = fmt::format_to(ctx.out(), "(");
+		ctx.advance_to(out);
+		out = fmt::formatter<T>::format(q.w, ctx);
+		out = fmt::format_to(out, ", ");
+		ctx.advance_to(out);
+		out = fmt::formatter<T>::format(q.x, ctx);
+		out = fmt::format_to(out, ", ");
+		ctx.advance_to(out);
+		out = fmt::formatter<T>::format(q.y, ctx);
+		out = fmt::format_to(out, ", ");
+		ctx.advance_to(out);
+		out = fmt::formatter<T>::format(q.z, ctx);
+		return fmt::format_to(out, ")");
+	}
+};
+
+#include <FSLinalg/Geometry/Quaternion_impl.hpp>
+
+#endif // FSLINALG_QUATERNION_HPP
@@ -0,0 +1,151 @@
+#ifndef FSLINALG_QUATERNION_IMPL_HPP
+#define FSLINALG_QUATERNION_IMPL_HPP
+
+#include <FSLinalg/Geometry/Quaternion.hpp>
+
+#include <cassert>
+#include <cmath>
+
+namespace FSLinalg
+{
+
+template<std::floating_point T> template<class Expr> 
+auto Quaternion<T>::fromAxisAngle(const MatrixBase<Expr>& axis, const T& angle) -> Quaternion requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector))
+{
+	const Matrix<T, Expr::nRows, Expr::nCols> a(axis.derived());
+	
+	const T s = std::sin(angle/T(2)) / std::sqrt(a[0]*a[0] + a[1]*a[1] + a[2]*a[2]);
+	
+	return Quaternion(std::cos(angle/T(2)), s*a[0], s*a[1], s*a[2]);
+}
+
+template<std::floating_point T> template<class Expr> 
+auto Quaternion<T>::fromMatrix(const MatrixBase<Expr>& base_m) -> Quaternion requires(Expr::nRows == 3 and Expr::nCols == 3)
+{
+	const Matrix<T, 3, 3> m(base_m.derived());
+	
+	const T trace = m(0,0) + m(1,1) + m(2,2);
+	
+	if (trace > T(0))
+	{
+		const T s = T(2)*std::sqrt(trace + T(1));
+		return Quaternion(s/T(4), (m(2,1) - m(1,2))/s, (m(0,2) - m(2,0))/s, (m(1,0) - m(0,1))/s);
+	}
+	else if (m(0,0) > m(1,1) and m(0,0) > m(2,2))
+	{
+		const T s = T(2)*std::sqrt(T(1) + m(0,0) - m(1,1) - m(2,2));
+		return Quaternion((m(2,1) - m(1,2))/s, s/T(4), (m(0,1) + m(1,0))/s, (m(0,2) + m(2,0))/s);
+	}
+	else if (m(1,1) > m(2,2))
+	{
+		const T s = T(2)*std::sqrt(T(1) + m(1,1) - m(0,0) - m(2,2));
+		return Quaternion((m(0,2) - m(2,0))/s, (m(0,1) + m(1,0))/s, s/T(4), (m(1,2) + m(2,1))/s);
+	}
+	else
+	{
+		const T s = T(2)*std::sqrt(T(1) + m(2,2) - m(0,0) - m(1,1));
+		return Quaternion((m(1,0) - m(0,1))/s, (m(0,2) + m(2,0))/s, (m(1,2) + m(2,1))/s, s/T(4));
+	}
+}
+
+template<std::floating_point T>
+Matrix<T, 3, 3> Quaternion<T>::toMatrix() const
+{
+	const T xx = x*x, yy = y*y, zz = z*z;
+	const T xy = x*y, xz = x*z, yz = y*z;
+	const T wx = w*x, wy = w*y, wz = w*z;
+	
+	return Matrix<T, 3, 3>({
+		{T(1) - T(2)*(yy + zz),        T(2)*(xy - wz),        T(2)*(xz + wy)},
+		{       T(2)*(xy + wz), T(1) - T(2)*(xx + zz),        T(2)*(yz - wx)},
+		{       T(2)*(xz - wy),        T(2)*(yz + wx), T(1) - T(2)*(xx + yy)}});
+}
+
+template<std::floating_point T> template<class Expr>
+auto Quaternion<T>::rotate(const MatrixBase<Expr>& base_v) const -> Vector requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector))
+{
+	const Matrix<T, Expr::nRows, Expr::nCols> v(base_v.derived());
+	
+	const T tx = T(2)*(y*v[2] - z*v[1]);
+	const T ty = T(2)*(z*v[0] - x*v[2]);
+	const T tz = T(2)*(x*v[1] - y*v[0]);
+	
+	return Vector({
+		v[0] + w*tx + (y*tz - z*ty),
+		v[1] + w*ty + (z*tx - x*tz),
+		v[2] + w*tz + (x*ty - y*tx)});
+}
+
+template<std::floating_point T> 
+Quaternion<T> nlerp(const Quaternion<T>& a, const Quaternion<T>& b, const T& t)
+{
+	const Quaternion<T> c = (dot(a, b) < T(0)) ? -b : b;
+	
+	return ((T(1) - t)*a + t*c).normalized();
+}
+
+template<std::floating_point T> 
+Quaternion<T> slerp(const Quaternion<T>& a, const Quaternion<T>& b, const T& t)
+{
+	T d = dot(a, b);
+	const Quaternion<T> c = (d < T(0)) ? -b : b;
+	d = std::abs(d);
+	
+	// sin(theta) vanishes, nlerp is as accurate
+	if (d > T(1) - T(16)*std::numeric_limits<T>::epsilon()) { return nlerp(a, c, t); }
+	
+	const T theta    = std::acos(d);
+	const T invSin   = T(1)/std::sin(theta);
+	
+	return (std::sin((T(1) - t)*theta)*invSin)*a + (std::sin(t*theta)*invSin)*c;
+}
+
+template<std::floating_point T> 
+void rotate(const Quaternion<T>& q, std::span<const RowVector<T,3>> in, std::span<RowVector<T,3>> out)
+{
+	assert(in.size() == out.size());
+	
+	const Matrix<T, 3, 3> R = q.toMatrix();
+	
+	const T r00 = R(0,0), r01 = R(0,1), r02 = R(0,2);
+	const T r10 = R(1,0), r11 = R(1,1), r12 = R(1,2);
+	const T r20 = R(2,0), r21 = R(2,1), r22 = R(2,2);
+	
+	for (size_t p=0; p!=in.size(); ++p)
+	{
+		const T v0 = in[p][0];
+		const T v1 = in[p][1];
+		const T v2 = in[p][2];
+		
+		out[p][0] = r00*v0 + r01*v1 + r02*v2;
+		out[p][1] = r10*v0 + r11*v1 + r12*v2;
+		out[p][2] = r20*v0 + r21*v1 + r22*v2;
+	}
+}
+
+template<std::floating_point T> 
+void rotate(std::span<const Quaternion<T>> q, std::span<const RowVector<T,3>> in, std::span<RowVector<T,3>> out)
+{
+	assert(q.size() == in.size() and in.size() == out.size());
+	
+	for (size_t p=0; p!=in.size(); ++p)
+	{
+		const T w = q[p].w, x = q[p].x, y = q[p].y, z = q[p].z;
+		
+		const T v0 = in[p][0];
+		const T v1 = in[p][1];
+		const T v2 = in[p][2];
+		
+		const T tx = T(2)*(y*v2 - z*v1);
+		const T ty = T(2)*(z*v0 - x*v2);
+		const T tz = T(2)*(x*v1 - y*v0);
+		
+		out[p][0] = v0 + w*tx + (y*tz - z*ty);
+		out[p][1] = v1 + w*ty + (z*tx - x*tz);
+		out[p][2] = v2 + w*tz + (x*ty - y*tx);
+	}
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_QUATERNION_IMPL_HPP
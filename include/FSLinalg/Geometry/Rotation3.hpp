@@ -0,0 +1,83 @@
+#ifndef FSLINALG_ROTATION3_HPP
+#define FSLINALG_ROTATION3_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Geometry/Quaternion.hpp>
+
+namespace FSLinalg
+{
+
+template<std::floating_point T> class Rotation3;
+
+template<std::floating_point T>
+struct MatrixTraits< Rotation3<T> >
+{	
+	using Scalar = T;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = false;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = false;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false; // a by-value copy of 4 scalars, which expressions can safely hold
+	
+	static constexpr Size nRows = 3;
+	static constexpr Size nCols = 3;
+};
+
+/*
+ * A 3D rotation stored as a unit quaternion, usable wherever a 3x3 matrix expression is. 
+ * Rotations compose as quaternions, in products with matrices they are expanded once into a 3x3 matrix 
+ * (12 multiplications), which makes them ordinary operands of the product chains.
+ */
+template<std::floating_point T>
+class Rotation3 : public MatrixBase< Rotation3<T> >
+{
+public:
+	using Self = Rotation3<T>;
+	FSLINALG_DEFINE_MATRIX
+	
+	Rotation3() = default;
+	
+	explicit Rotation3(const Quaternion<T>& q) : m_quaternion(q) {}
+	
+	template<class Expr> 
+	explicit Rotation3(const MatrixBase<Expr>& m) requires(Expr::nRows == 3 and Expr::nCols == 3) : m_quaternion(Quaternion<T>::fromMatrix(m)) {}
+	
+	template<class Expr> 
+	static Rotation3 fromAxisAngle(const MatrixBase<Expr>& axis, const T& angle) requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector)) { return Rotation3(Quaternion<T>::fromAxisAngle(axis, angle)); }
+	
+	const Quaternion<T>& quaternion() const { return m_quaternion; }
+	
+	Matrix<T, 3, 3> toMatrix() const { return m_quaternion.toMatrix(); }
+	
+	Rotation3 inverse() const { return Rotation3(m_quaternion.conjugate()); }
+	
+	// brings back the quaternion on the unit sphere after many compositions
+	void normalize() { m_quaternion = m_quaternion.normalized(); }
+	
+	friend Rotation3 operator*(const Rotation3& a, const Rotation3& b) { return Rotation3(a.m_quaternion*b.m_quaternion); }
+	
+	Rotation3& operator*=(const Rotation3& other) { m_quaternion *= other.m_quaternion; return *this; }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void assignToImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void incrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void decrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+private:
+	Quaternion<T> m_quaternion;
+};
+
+} // namespace FSLinalg
+
+#include <FSLinalg/Geometry/Rotation3_impl.hpp>
+
+#endif // FSLINALG_ROTATION3_HPP
@@ -0,0 +1,41 @@
+#ifndef FSLINALG_ROTATION3_IMPL_HPP
+#define FSLINALG_ROTATION3_IMPL_HPP
+
+#include <FSLinalg/Geometry/Rotation3.hpp>
+
+namespace FSLinalg
+{
+
+template<std::floating_point T> template<typename Bool, typename Alpha, class Dst>
+void Rotation3<T>::assignToImpl(const Bool, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	const Matrix<T, 3, 3> R = toMatrix();
+	for (Size i=0; i!=3; ++i)
+	{
+		for (Size j=0; j!=3; ++j) { dst(i,j) = alpha*R(i,j); }
+	}
+}
+
+template<std::floating_point T> template<typename Bool, typename Alpha, class Dst>
+void Rotation3<T>::incrementImpl(const Bool, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	const Matrix<T, 3, 3> R = toMatrix();
+	for (Size i=0; i!=3; ++i)
+	{
+		for (Size j=0; j!=3; ++j) { dst(i,j) += alpha*R(i,j); }
+	}
+}
+
+template<std::floating_point T> template<typename Bool, typename Alpha, class Dst>
+void Rotation3<T>::decrementImpl(const Bool, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	const Matrix<T, 3, 3> R = toMatrix();
+	for (Size i=0; i!=3; ++i)
+	{
+		for (Size j=0; j!=3; ++j) { dst(i,j) -= alpha*R(i,j); }
+	}
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_ROTATION3_IMPL_HPP
@@ -0,0 +1,141 @@
+#ifndef FSLINALG_HALF_FLOAT_HPP
+#define FSLINALG_HALF_FLOAT_HPP
+
+#include <FSLinalg/Scalar.hpp>
+
+#include <bit>
+#include <cstdint>
+#include <cmath>
+
+#if defined(__STDCPP_FLOAT16_T__) or defined(__STDCPP_BFLOAT16_T__)
+#include <stdfloat>
+#endif
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+// IEEE 754 binary16: 1 sign bit, 5 exponent bits, 10 mantissa bits
+struct BinaryHalfFormat
+{
+	static constexpr std::uint16_t epsilonBits  = 0x1400;
+	static constexpr std::uint16_t maxBits      = 0x7BFF;
+	static constexpr std::uint16_t minBits      = 0x0400;
+	static constexpr std::uint16_t infinityBits = 0x7C00;
+	
+	static constexpr std::uint16_t fromFloat(const float value);
+	static constexpr float         toFloat  (const std::uint16_t bits);
+};
+
+// bfloat16: the 16 upper bits of an IEEE 754 binary32
+struct BrainHalfFormat
+{
+	static constexpr std::uint16_t epsilonBits  = 0x3C00;
+	static constexpr std::uint16_t maxBits      = 0x7F7F;
+	static constexpr std::uint16_t minBits      = 0x0080;
+	static constexpr std::uint16_t infinityBits = 0x7F80;
+	
+	static constexpr std::uint16_t fromFloat(const float value);
+	static constexpr float         toFloat  (const std::uint16_t bits);
+};
+
+} // namespace detail
+
+/*
+ * Software 16 bits floating point type, used when the compiler has no native type.
+ * Only storage is 16 bits wide: every operation is carried out in float and rounded to nearest even on store.
+ * The type is structural so that it can be used as a template argument (BIC::Fixed).
+ */
+template<class Format>
+struct SoftwareHalf
+{
+	std::uint16_t bits;
+	
+	constexpr SoftwareHalf() : bits(0) {}
+	
+	template<typename T> requires(std::is_arithmetic_v<T>)
+	explicit constexpr SoftwareHalf(const T value) : bits(Format::fromFloat(static_cast<float>(value))) {}
+	
+	constexpr operator float() const { return Format::toFloat(bits); }
+	
+	static constexpr SoftwareHalf fromBits(const std::uint16_t a_bits) { SoftwareHalf ret; ret.bits = a_bits; return ret; }
+	
+	friend constexpr SoftwareHalf operator+(const SoftwareHalf a, const SoftwareHalf b) { return SoftwareHalf(float(a) + float(b)); }
+	friend constexpr SoftwareHalf operator-(const SoftwareHalf a, const SoftwareHalf b) { return SoftwareHalf(float(a) - float(b)); }
+	friend constexpr SoftwareHalf operator*(const SoftwareHalf a, const SoftwareHalf b) { return SoftwareHalf(float(a) * float(b)); }
+	friend constexpr SoftwareHalf operator/(const SoftwareHalf a, const SoftwareHalf b) { return SoftwareHalf(float(a) / float(b)); }
+	friend constexpr SoftwareHalf operator-(const SoftwareHalf a)                        { return fromBits(std::uint16_t(a.bits ^ 0x8000)); }
+	
+	constexpr SoftwareHalf& operator+=(const SoftwareHalf other) { return *this = *this + other; }
+	constexpr SoftwareHalf& operator-=(const SoftwareHalf other) { return *this = *this - other; }
+	constexpr SoftwareHalf& operator*=(const SoftwareHalf other) { return *this = *this * other; }
+	constexpr SoftwareHalf& operator/=(const SoftwareHalf other) { return *this = *this / other; }
+	
+	friend SoftwareHalf abs (const SoftwareHalf a) { return fromBits(std::uint16_t(a.bits & 0x7FFF)); }
+	friend SoftwareHalf sqrt(const SoftwareHalf a) { return SoftwareHalf(std::sqrt(float(a))); }
+};
+
+using SoftwareFloat16  = SoftwareHalf<detail::BinaryHalfFormat>;
+using SoftwareBFloat16 = SoftwareHalf<detail::BrainHalfFormat>;
+
+#if defined(__STDCPP_FLOAT16_T__)
+using float16 = std::float16_t;
+#elif defined(__FLT16_MAX__)
+using float16 = _Float16;
+#else
+using float16 = SoftwareFloat16;
+#endif
+
+#if defined(__STDCPP_BFLOAT16_T__)
+using bfloat16 = std::bfloat16_t;
+#else
+using bfloat16 = SoftwareBFloat16;
+#endif
+
+template<class Format>
+struct NumTraits< SoftwareHalf<Format> >
+{
+	using Real = SoftwareHalf<Format>;
+	
+	static constexpr bool isComplex = false;
+	static constexpr Real epsilon   = Real::fromBits(Format::epsilonBits);
+	static constexpr Real max       = Real::fromBits(Format::maxBits);
+	static constexpr Real min       = Real::fromBits(Format::minBits);
+	static constexpr Real infinity  = Real::fromBits(Format::infinityBits);
+};
+
+// GCC < 13 provides _Float16 but does not treat it as a std::floating_point
+#if not defined(__STDCPP_FLOAT16_T__) and defined(__FLT16_MAX__)
+template<>
+struct NumTraits<_Float16>
+{
+	using Real = _Float16;
+	
+	static constexpr bool isComplex = false;
+	static constexpr Real epsilon   = std::bit_cast<Real>(detail::BinaryHalfFormat::epsilonBits);
+	static constexpr Real max       = std::bit_cast<Real>(detail::BinaryHalfFormat::maxBits);
+	static constexpr Real min       = std::bit_cast<Real>(detail::BinaryHalfFormat::minBits);
+	static constexpr Real infinity  = std::bit_cast<Real>(detail::BinaryHalfFormat::infinityBits);
+};
+#endif
+
+// 16 bits types are only meant for storage, sums are accumulated in float
+template<class Format> struct AccumulatorTraits< SoftwareHalf<Format> > { using Type = float; };
+
+#if defined(__STDCPP_FLOAT16_T__) or defined(__FLT16_MAX__)
+template<> struct AccumulatorTraits<float16> { using Type = float; };
+#endif
+#if defined(__STDCPP_BFLOAT16_T__)
+template<> struct AccumulatorTraits<bfloat16> { using Type = float; };
+#endif
+
+} // namespace FSLinalg
+
+template<class Format, std::floating_point T> struct std::common_type< FSLinalg::SoftwareHalf<Format>, T > { using type = T; };
+template<class Format, std::floating_point T> struct std::common_type< T, FSLinalg::SoftwareHalf<Format> > { using type = T; };
+
+#include <FSLinalg/HalfFloat_impl.hpp>
+
+#endif // FSLINALG_HALF_FLOAT_HPP
@@ -0,0 +1,25 @@
+#ifndef FSLINALG_HALF_FLOAT_FORMATER_HPP
+#define FSLINALG_HALF_FLOAT_FORMATER_HPP
+
+#include <FSLinalg/HalfFloat.hpp>
+
+#include <fmt/core.h>
+
+// 16 bits scalars are formatted as the float they widen to, with the float format spec
+template<class Format>
+struct fmt::formatter< FSLinalg::SoftwareHalf<Format> > : fmt::formatter<float>
+{
+	template <typename Context>
+	auto format(const FSLinalg::SoftwareHalf<Format>& value, Context& ctx) const { return fmt::formatter<float>::format(float(value), ctx); }
+};
+
+#if not defined(__STDCPP_FLOAT16_T__) and defined(__FLT16_MAX__)
+template<>
+struct fmt::formatter<_Float16> : fmt::formatter<float>
+{
+	template <typename Context>
+	auto format(const _Float16& value, Context& ctx) const { return fmt::formatter<float>::format(float(value), ctx); }
+};
+#endif
+
+#endif // FSLINALG_HALF_FLOAT_FORMATER_HPP
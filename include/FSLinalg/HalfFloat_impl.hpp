@@ -0,0 +1,77 @@
+#ifndef FSLINALG_HALF_FLOAT_IMPL_HPP
+#define FSLINALG_HALF_FLOAT_IMPL_HPP
+
+#include <FSLinalg/HalfFloat.hpp>
+
+namespace FSLinalg
+{
+namespace detail
+{
+
+constexpr std::uint16_t BinaryHalfFormat::fromFloat(const float value)
+{
+	const std::uint32_t f    = std::bit_cast<std::uint32_t>(value);
+	const std::uint32_t sign = (f >> 16) & 0x8000u;
+	const std::uint32_t absf = f & 0x7FFFFFFFu;
+	
+	// Inf and NaN (kept quiet)
+	if (absf >= 0x7F800000u) { return std::uint16_t(sign | 0x7C00u | (absf > 0x7F800000u ? 0x0200u : 0u)); }
+	// rounds to infinity (>= 65520)
+	if (absf >= 0x477FF000u) { return std::uint16_t(sign | 0x7C00u); }
+	// subnormal halves (< 2^-14)
+	if (absf <  0x38800000u)
+	{
+		const std::uint32_t shift = 126u - (absf >> 23);
+		if (shift > 24u) { return std::uint16_t(sign); }
+		
+		const std::uint32_t mantissa = (absf & 0x007FFFFFu) | 0x00800000u;
+		const std::uint32_t rem      = mantissa & ((1u << shift) - 1u);
+		const std::uint32_t halfway  = 1u << (shift - 1u);
+		
+		std::uint32_t h = mantissa >> shift;
+		if (rem > halfway or (rem == halfway and (h & 1u))) { ++h; }
+		return std::uint16_t(sign | h);
+	}
+	
+	// normal halves: rebias the exponent and round the 13 dropped mantissa bits to nearest even
+	std::uint32_t h = (absf - 0x38000000u) >> 13;
+	const std::uint32_t rem = absf & 0x1FFFu;
+	if (rem > 0x1000u or (rem == 0x1000u and (h & 1u))) { ++h; }
+	return std::uint16_t(sign | h);
+}
+
+constexpr float BinaryHalfFormat::toFloat(const std::uint16_t bits)
+{
+	const std::uint32_t sign     = std::uint32_t(bits & 0x8000u) << 16;
+	const std::uint32_t exponent = (bits >> 10) & 0x1Fu;
+	const std::uint32_t mantissa = bits & 0x03FFu;
+	
+	if (exponent == 0x1Fu) { return std::bit_cast<float>(sign | 0x7F800000u | (mantissa << 13)); }
+	if (exponent == 0u)
+	{
+		const float value = float(mantissa) * 0x1p-24f;
+		return sign ? -value : value;
+	}
+	return std::bit_cast<float>(sign | ((exponent + 112u) << 23) | (mantissa << 13));
+}
+
+constexpr std::uint16_t BrainHalfFormat::fromFloat(const float value)
+{
+	const std::uint32_t f = std::bit_cast<std::uint32_t>(value);
+	
+	// NaN (kept quiet)
+	if ((f & 0x7FFFFFFFu) > 0x7F800000u) { return std::uint16_t((f >> 16) | 0x0040u); }
+	
+	// round to nearest even, overflows to infinity
+	return std::uint16_t((f + 0x7FFFu + ((f >> 16) & 1u)) >> 16);
+}
+
+constexpr float BrainHalfFormat::toFloat(const std::uint16_t bits)
+{
+	return std::bit_cast<float>(std::uint32_t(bits) << 16);
+}
+
+} // namespace detail
+} // namespace FSLinalg
+
+#endif // FSLINALG_HALF_FLOAT_IMPL_HPP
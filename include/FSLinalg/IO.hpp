@@ -0,0 +1,4 @@
+#include <FSLinalg/IO/BinaryFormat.hpp>
+#include <FSLinalg/IO/BinaryWriter.hpp>
+#include <FSLinalg/IO/BinaryReader.hpp>
+#include <FSLinalg/IO/TextExport.hpp>
@@ -0,0 +1,116 @@
+#ifndef FSLINALG_IO_BINARY_FORMAT_HPP
+#define FSLINALG_IO_BINARY_FORMAT_HPP
+
+#include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/Matrix/MatrixView.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorView.hpp>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+/*
+ * Binary container of fixed-size records (Matrix or Tensor), laid out as
+ *  - a BinaryHeader, padded to payloadAlignment bytes,
+ *  - count records of recordBytes raw row-major scalars each, back to back.
+ * Files are written in the byte order of the writer: the endianness tag reads differently on a machine of the other
+ * byte order, which readers reject since their views point to the raw payload.
+ */
+enum class ScalarType : std::uint32_t
+{
+	Int8 = 1, Int16, Int32, Int64,
+	UInt8, UInt16, UInt32, UInt64,
+	Float32, Float64,
+	ComplexFloat32, ComplexFloat64
+};
+
+enum class Layout : std::uint32_t { RowMajor = 1 };
+
+template<typename T> struct ScalarTypeOf;
+
+template<> struct ScalarTypeOf<std::int8_t>           : BIC::Fixed<ScalarType, ScalarType::Int8>           {};
+template<> struct ScalarTypeOf<std::int16_t>          : BIC::Fixed<ScalarType, ScalarType::Int16>          {};
+template<> struct ScalarTypeOf<std::int32_t>          : BIC::Fixed<ScalarType, ScalarType::Int32>          {};
+template<> struct ScalarTypeOf<std::int64_t>          : BIC::Fixed<ScalarType, ScalarType::Int64>          {};
+template<> struct ScalarTypeOf<std::uint8_t>          : BIC::Fixed<ScalarType, ScalarType::UInt8>          {};
+template<> struct ScalarTypeOf<std::uint16_t>         : BIC::Fixed<ScalarType, ScalarType::UInt16>         {};
+template<> struct ScalarTypeOf<std::uint32_t>         : BIC::Fixed<ScalarType, ScalarType::UInt32>         {};
+template<> struct ScalarTypeOf<std::uint64_t>         : BIC::Fixed<ScalarType, ScalarType::UInt64>         {};
+template<> struct ScalarTypeOf<float>                 : BIC::Fixed<ScalarType, ScalarType::Float32>        {};
+template<> struct ScalarTypeOf<double>                : BIC::Fixed<ScalarType, ScalarType::Float64>        {};
+template<> struct ScalarTypeOf<std::complex<float>>  : BIC::Fixed<ScalarType, ScalarType::ComplexFloat32> {};
+template<> struct ScalarTypeOf<std::complex<double>>  : BIC::Fixed<ScalarType, ScalarType::ComplexFloat64> {};
+
+struct BinaryHeader
+{
+	static constexpr std::array<char, 8> expectedMagic = {'F', 'S', 'L', 'B', 'I', 'N', '\0', '\0'};
+	
+	static constexpr std::uint32_t currentVersion = 1;
+	static constexpr std::uint32_t endiannessTag  = 0x01020304;
+	static constexpr std::uint32_t maxRank        = 8;
+	
+	std::array<char, 8>                magic;
+	std::uint32_t                      version;
+	std::uint32_t                      endianness;
+	ScalarType                         scalarType;
+	std::uint32_t                      scalarBytes;
+	Layout                             layout;
+	std::uint32_t                      rank;
+	std::array<std::uint32_t, maxRank> shape;
+	std::uint64_t                      recordBytes;
+	std::uint64_t                      count;
+	std::uint64_t                      payloadOffset;
+};
+
+// the payload starts at a multiple of the cache line and is aligned to it in a mapping starting on a page
+inline constexpr std::size_t payloadAlignment = 128;
+
+static_assert(sizeof(BinaryHeader) <= payloadAlignment, "The header must fit before the payload");
+
+template<class Record> struct RecordTraits;
+
+template<typename T, unsigned int Nrows, unsigned int Ncols>
+struct RecordTraits< Matrix<T, Nrows, Ncols> >
+{
+	using Scalar = T;
+	using View   = MatrixView<T, Nrows, Ncols>;
+	
+	static constexpr std::uint32_t                                     rank  = 2;
+	static constexpr std::array<std::uint32_t, BinaryHeader::maxRank>  shape = {Nrows, Ncols};
+	static constexpr std::size_t                                       size  = std::size_t(Nrows)*Ncols;
+};
+
+template<typename T, unsigned int... dims>
+struct RecordTraits< Tensor<T, dims...> >
+{
+	static_assert(sizeof...(dims) <= BinaryHeader::maxRank, "Tensor rank exceeds the format limit");
+	
+	using Scalar = T;
+	using View   = TensorView<T, dims...>;
+	
+	static constexpr std::uint32_t                                     rank  = sizeof...(dims);
+	static constexpr std::array<std::uint32_t, BinaryHeader::maxRank>  shape = {dims...};
+	static constexpr std::size_t                                       size  = (std::size_t(1) * ... * dims);
+};
+
+// header describing count records of type Record
+template<class Record>
+BinaryHeader makeHeader(const std::uint64_t count);
+
+// throws std::runtime_error when header does not describe records of type Record
+template<class Record>
+void checkHeader(const BinaryHeader& header);
+
+} // namespace IO
+} // namespace FSLinalg
+
+#include <FSLinalg/IO/BinaryFormat_impl.hpp>
+
+#endif // FSLINALG_IO_BINARY_FORMAT_HPP
@@ -0,0 +1,72 @@
+#ifndef FSLINALG_IO_BINARY_FORMAT_IMPL_HPP
+#define FSLINALG_IO_BINARY_FORMAT_IMPL_HPP
+
+#include <FSLinalg/IO/BinaryFormat.hpp>
+
+#include <fmt/core.h>
+#include <fmt/ranges.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+template<class Record>
+BinaryHeader makeHeader(const std::uint64_t count)
+{
+	using Traits = RecordTraits<Record>;
+	using Scalar = typename Traits::Scalar;
+	
+	BinaryHeader header{};
+	header.magic         = BinaryHeader::expectedMagic;
+	header.version       = BinaryHeader::currentVersion;
+	header.endianness    = BinaryHeader::endiannessTag;
+	header.scalarType    = ScalarTypeOf<Scalar>::value;
+	header.scalarBytes   = sizeof(Scalar);
+	header.layout        = Layout::RowMajor;
+	header.rank          = Traits::rank;
+	header.shape         = Traits::shape;
+	header.recordBytes   = Traits::size*sizeof(Scalar);
+	header.count         = count;
+	header.payloadOffset = payloadAlignment;
+	return header;
+}
+
+template<class Record>
+void checkHeader(const BinaryHeader& header)
+{
+	const BinaryHeader expected = makeHeader<Record>(header.count);
+	
+	if (header.magic != expected.magic)
+	{
+		throw std::runtime_error("FSLinalg::IO: not a FSLinalg binary file");
+	}
+	if (header.endianness != expected.endianness)
+	{
+		throw std::runtime_error("FSLinalg::IO: the file was written with a different byte order");
+	}
+	if (header.version != expected.version)
+	{
+		throw std::runtime_error(fmt::format("FSLinalg::IO: unsupported format version {} (expected {})", header.version, expected.version));
+	}
+	if (header.scalarType != expected.scalarType or header.scalarBytes != expected.scalarBytes)
+	{
+		throw std::runtime_error("FSLinalg::IO: scalar type mismatch");
+	}
+	if (header.layout != expected.layout or header.rank != expected.rank or header.shape != expected.shape or header.recordBytes != expected.recordBytes)
+	{
+		throw std::runtime_error(fmt::format("FSLinalg::IO: record shape mismatch, the file stores {}", fmt::join(header.shape.begin(), header.shape.begin() + std::min(header.rank, BinaryHeader::maxRank), "x")));
+	}
+	if (header.payloadOffset < sizeof(BinaryHeader) or header.payloadOffset % alignof(typename RecordTraits<Record>::Scalar) != 0)
+	{
+		throw std::runtime_error("FSLinalg::IO: invalid payload offset");
+	}
+}
+
+} // namespace IO
+} // namespace FSLinalg
+
+#endif // FSLINALG_IO_BINARY_FORMAT_IMPL_HPP
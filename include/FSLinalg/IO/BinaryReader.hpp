@@ -0,0 +1,89 @@
+#ifndef FSLINALG_IO_BINARY_READER_HPP
+#define FSLINALG_IO_BINARY_READER_HPP
+
+#include <FSLinalg/IO/BinaryFormat.hpp>
+#include <FSLinalg/IO/MappedRegion.hpp>
+
+#include <cstdint>
+#include <filesystem>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+/*
+ * Zero-copy reader of a file written by BinaryWriter<Record>: the whole file is memory mapped and records are read
+ * through views (MatrixView or TensorView) pointing into the mapping, which remain valid as long as the reader lives.
+ * Pages are only loaded when accessed, but every accessed page stays mapped: see BinaryChunkReader for single pass 
+ * reads of files larger than the memory. Without mmap (FSLINALG_IO_HAS_MMAP == 0) the whole file is read up front.
+ */
+template<class Record>
+class BinaryReader
+{
+public:
+	using Traits = RecordTraits<Record>;
+	using Scalar = typename Traits::Scalar;
+	using View   = typename Traits::View;
+	
+	static constexpr std::size_t recordBytes = Traits::size*sizeof(Scalar);
+	
+	explicit BinaryReader(const std::filesystem::path& path);
+	
+	const BinaryHeader& header() const { return m_header; }
+	
+	std::uint64_t size() const { return m_header.count; }
+	
+	View operator[](const std::uint64_t i) const;
+private:
+	BinaryHeader         m_header;
+	detail::MappedRegion m_region;
+};
+
+/*
+ * Single pass reader of a file written by BinaryWriter<Record>, mapping chunkSize records at a time: 
+ * 
+ *     BinaryChunkReader<Record> reader(path, chunkSize);
+ *     while (reader.next()) { for (size_t i=0; i!=reader.size(); ++i) { use(reader.offset() + i, reader[i]); } }
+ * 
+ * Views of a chunk are invalidated by the next call to next().
+ */
+template<class Record>
+class BinaryChunkReader
+{
+public:
+	using Traits = RecordTraits<Record>;
+	using Scalar = typename Traits::Scalar;
+	using View   = typename Traits::View;
+	
+	static constexpr std::size_t recordBytes = Traits::size*sizeof(Scalar);
+	
+	BinaryChunkReader(const std::filesystem::path& path, const std::size_t chunkSize);
+	
+	const BinaryHeader& header() const { return m_header; }
+	
+	// maps the next chunk, returns false once every record has been read
+	bool next();
+	
+	std::uint64_t totalSize() const { return m_header.count; }
+	
+	// index of the first record of the current chunk, and number of records in it
+	std::uint64_t offset() const { return m_offset; }
+	std::size_t   size()   const { return m_size;   }
+	
+	View operator[](const std::size_t i) const;
+private:
+	detail::FileDescriptor m_file;
+	BinaryHeader           m_header;
+	std::size_t            m_chunkSize;
+	std::uint64_t          m_offset;
+	std::size_t            m_size;
+	detail::MappedRegion   m_region;
+};
+
+} // namespace IO
+} // namespace FSLinalg
+
+#include <FSLinalg/IO/BinaryReader_impl.hpp>
+
+#endif // FSLINALG_IO_BINARY_READER_HPP
@@ -0,0 +1,91 @@
+#ifndef FSLINALG_IO_BINARY_READER_IMPL_HPP
+#define FSLINALG_IO_BINARY_READER_IMPL_HPP
+
+#include <FSLinalg/IO/BinaryReader.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace FSLinalg
+{
+namespace IO
+{
+namespace detail
+{
+
+template<class Record>
+BinaryHeader readHeader(const FileDescriptor& file, const std::uint64_t recordBytes)
+{
+	const std::uint64_t fileSize = file.fileSize();
+	if (fileSize < sizeof(BinaryHeader)) { throw std::runtime_error("FSLinalg::IO: not a FSLinalg binary file"); }
+	
+	BinaryHeader header;
+	file.readAt(&header, sizeof(BinaryHeader), 0);
+	checkHeader<Record>(header);
+	
+	if (header.payloadOffset > fileSize or (fileSize - header.payloadOffset)/recordBytes < header.count)
+	{
+		throw std::runtime_error("FSLinalg::IO: truncated file");
+	}
+	return header;
+}
+
+} // namespace detail
+
+template<class Record>
+BinaryReader<Record>::BinaryReader(const std::filesystem::path& path) : 
+	m_header(), 
+	m_region()
+{
+	// the mapping outlives the file descriptor
+	const detail::FileDescriptor file(path);
+	m_header = detail::readHeader<Record>(file, recordBytes);
+	m_region = detail::MappedRegion(file, m_header.payloadOffset, std::size_t(m_header.count*recordBytes));
+}
+
+template<class Record>
+auto BinaryReader<Record>::operator[](const std::uint64_t i) const -> View
+{
+	assert(i < size());
+	return View(reinterpret_cast<const Scalar*>(m_region.data() + i*recordBytes));
+}
+
+template<class Record>
+BinaryChunkReader<Record>::BinaryChunkReader(const std::filesystem::path& path, const std::size_t chunkSize) : 
+	m_file(path), 
+	m_header(detail::readHeader<Record>(m_file, recordBytes)), 
+	m_chunkSize(chunkSize), 
+	m_offset(0), 
+	m_size(0), 
+	m_region()
+{
+	assert(chunkSize > 0);
+}
+
+template<class Record>
+bool BinaryChunkReader<Record>::next()
+{
+	m_offset += m_size;
+	m_size    = std::size_t(std::min<std::uint64_t>(m_chunkSize, m_header.count - m_offset));
+	
+	// the previous chunk is unmapped first, so that at most one chunk is mapped at a time
+	m_region = detail::MappedRegion();
+	if (m_size == 0) { return false; }
+	
+	m_region = detail::MappedRegion(m_file, m_header.payloadOffset + m_offset*recordBytes, m_size*recordBytes);
+	m_region.adviseSequential();
+	return true;
+}
+
+template<class Record>
+auto BinaryChunkReader<Record>::operator[](const std::size_t i) const -> View
+{
+	assert(i < m_size);
+	return View(reinterpret_cast<const Scalar*>(m_region.data() + i*recordBytes));
+}
+
+} // namespace IO
+} // namespace FSLinalg
+
+#endif // FSLINALG_IO_BINARY_READER_IMPL_HPP
@@ -0,0 +1,57 @@
+#ifndef FSLINALG_IO_BINARY_WRITER_HPP
+#define FSLINALG_IO_BINARY_WRITER_HPP
+
+#include <FSLinalg/IO/BinaryFormat.hpp>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+/*
+ * Streaming writer of records of type Record (a Matrix or a Tensor), see BinaryFormat.hpp. Records are appended one at
+ * a time (or one span at a time), so files larger than the memory can be written. The record count is written in the 
+ * header by close(), the file is not readable before.
+ */
+template<class Record>
+class BinaryWriter
+{
+public:
+	using Traits = RecordTraits<Record>;
+	using Scalar = typename Traits::Scalar;
+	
+	static constexpr std::size_t recordBytes = Traits::size*sizeof(Scalar);
+	
+	explicit BinaryWriter(const std::filesystem::path& path);
+	~BinaryWriter();
+	
+	BinaryWriter(const BinaryWriter&) = delete;
+	BinaryWriter& operator=(const BinaryWriter&) = delete;
+	
+	// appends a record, an expression being evaluated first
+	template<class Expr> void write(const Expr& record) requires(std::is_constructible<Record, const Expr&>::value);
+	
+	// appends records stored contiguously, with a single write
+	void write(std::span<const Record> records);
+	
+	std::uint64_t size() const { return m_count; }
+	
+	void close();
+private:
+	void writeHeader();
+	
+	std::ofstream m_stream;
+	std::uint64_t m_count;
+};
+
+} // namespace IO
+} // namespace FSLinalg
+
+#include <FSLinalg/IO/BinaryWriter_impl.hpp>
+
+#endif // FSLINALG_IO_BINARY_WRITER_HPP
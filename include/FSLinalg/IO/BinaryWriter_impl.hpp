@@ -0,0 +1,81 @@
+#ifndef FSLINALG_IO_BINARY_WRITER_IMPL_HPP
+#define FSLINALG_IO_BINARY_WRITER_IMPL_HPP
+
+#include <FSLinalg/IO/BinaryWriter.hpp>
+
+#include <array>
+#include <cstring>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+template<class Record>
+BinaryWriter<Record>::BinaryWriter(const std::filesystem::path& path) : 
+	m_stream(), 
+	m_count(0)
+{
+	m_stream.exceptions(std::ios::failbit | std::ios::badbit);
+	m_stream.open(path, std::ios::binary | std::ios::trunc);
+	writeHeader();
+}
+
+template<class Record>
+BinaryWriter<Record>::~BinaryWriter()
+{
+	// an unclosed file is closed on a best effort basis, call close() to get the errors
+	if (m_stream.is_open()) 
+	{
+		try { close(); } catch (const std::ios::failure&) {}
+	}
+}
+
+template<class Record>
+void BinaryWriter<Record>::writeHeader()
+{
+	std::array<char, payloadAlignment> block{};
+	const BinaryHeader header = makeHeader<Record>(m_count);
+	std::memcpy(block.data(), &header, sizeof(BinaryHeader));
+	
+	m_stream.seekp(0);
+	m_stream.write(block.data(), std::streamsize(block.size()));
+}
+
+template<class Record> template<class Expr> 
+void BinaryWriter<Record>::write(const Expr& record) requires(std::is_constructible<Record, const Expr&>::value)
+{
+	if constexpr (std::is_same<Expr, Record>::value)
+	{
+		m_stream.write(reinterpret_cast<const char*>(record.data()), std::streamsize(recordBytes));
+	}
+	else
+	{
+		const Record tmp(record);
+		m_stream.write(reinterpret_cast<const char*>(tmp.data()), std::streamsize(recordBytes));
+	}
+	++m_count;
+}
+
+template<class Record>
+void BinaryWriter<Record>::write(std::span<const Record> records)
+{
+	static_assert(sizeof(Record) == recordBytes and std::is_standard_layout<Record>::value, "Records must be stored without padding");
+	
+	m_stream.write(reinterpret_cast<const char*>(records.data()), std::streamsize(records.size()*recordBytes));
+	m_count += records.size();
+}
+
+template<class Record>
+void BinaryWriter<Record>::close()
+{
+	const std::streampos end = m_stream.tellp();
+	writeHeader();
+	m_stream.seekp(end);
+	m_stream.close();
+}
+
+} // namespace IO
+} // namespace FSLinalg
+
+#endif // FSLINALG_IO_BINARY_WRITER_IMPL_HPP
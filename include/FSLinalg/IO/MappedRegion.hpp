@@ -0,0 +1,90 @@
+#ifndef FSLINALG_IO_MAPPED_REGION_HPP
+#define FSLINALG_IO_MAPPED_REGION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+// files are memory mapped on POSIX systems, and read into owned buffers elsewhere (or when FSLINALG_IO_NO_MMAP is defined)
+#if (defined(__unix__) or defined(__APPLE__)) and not defined(FSLINALG_IO_NO_MMAP)
+	#define FSLINALG_IO_HAS_MMAP 1
+#else
+	#define FSLINALG_IO_HAS_MMAP 0
+	#include <fstream>
+	#include <memory>
+#endif
+
+namespace FSLinalg
+{
+namespace IO
+{
+namespace detail
+{
+
+// read-only file descriptor (a binary input stream without mmap), closed on destruction
+class FileDescriptor
+{
+public:
+	explicit FileDescriptor(const std::filesystem::path& path);
+	~FileDescriptor();
+	
+	FileDescriptor(const FileDescriptor&) = delete;
+	FileDescriptor& operator=(const FileDescriptor&) = delete;
+	
+#if FSLINALG_IO_HAS_MMAP
+	int get() const { return m_fd; }
+#endif
+	
+	std::uint64_t fileSize() const;
+	
+	// reads exactly nBytes at offset, throws otherwise
+	void readAt(void* dst, const std::size_t nBytes, const std::uint64_t offset) const;
+private:
+#if FSLINALG_IO_HAS_MMAP
+	int m_fd;
+#else
+	mutable std::ifstream m_stream;
+	std::uint64_t         m_size;
+#endif
+};
+
+/*
+ * Read-only private mapping of the bytes [offset, offset + length) of a file. The mapping itself starts on the page 
+ * containing offset, data() pointing to the requested first byte. Without mmap the bytes are read into a buffer owned
+ * by the region, so that a BinaryReader then holds the whole payload in memory.
+ */
+class MappedRegion
+{
+public:
+	MappedRegion() : m_base(nullptr), m_length(0), m_data(nullptr) {}
+	MappedRegion(const FileDescriptor& file, const std::uint64_t offset, const std::size_t length);
+	~MappedRegion() { unmap(); }
+	
+	MappedRegion(MappedRegion&& other) noexcept;
+	MappedRegion& operator=(MappedRegion&& other) noexcept;
+	
+	MappedRegion(const MappedRegion&) = delete;
+	MappedRegion& operator=(const MappedRegion&) = delete;
+	
+	const std::byte* data() const { return m_data; }
+	
+	// hints the kernel that the region is read once, front to back
+	void adviseSequential() const;
+private:
+	void unmap() noexcept;
+	
+	void*            m_base;
+	std::size_t      m_length;
+	const std::byte* m_data;
+#if not FSLINALG_IO_HAS_MMAP
+	std::unique_ptr<std::byte[]> m_buffer;
+#endif
+};
+
+} // namespace detail
+} // namespace IO
+} // namespace FSLinalg
+
+#include <FSLinalg/IO/MappedRegion_impl.hpp>
+
+#endif // FSLINALG_IO_MAPPED_REGION_HPP
@@ -0,0 +1,185 @@
+#ifndef FSLINALG_IO_MAPPED_REGION_IMPL_HPP
+#define FSLINALG_IO_MAPPED_REGION_IMPL_HPP
+
+#include <FSLinalg/IO/MappedRegion.hpp>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#if FSLINALG_IO_HAS_MMAP
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace FSLinalg
+{
+namespace IO
+{
+namespace detail
+{
+
+#if FSLINALG_IO_HAS_MMAP
+
+inline FileDescriptor::FileDescriptor(const std::filesystem::path& path) : 
+	m_fd(::open(path.c_str(), O_RDONLY | O_CLOEXEC))
+{
+	if (m_fd < 0) { throw std::system_error(errno, std::generic_category(), "FSLinalg::IO: cannot open " + path.string()); }
+}
+
+inline FileDescriptor::~FileDescriptor()
+{
+	::close(m_fd);
+}
+
+inline std::uint64_t FileDescriptor::fileSize() const
+{
+	struct stat info;
+	if (::fstat(m_fd, &info) != 0) { throw std::system_error(errno, std::generic_category(), "FSLinalg::IO: fstat"); }
+	return std::uint64_t(info.st_size);
+}
+
+inline void FileDescriptor::readAt(void* dst, const std::size_t nBytes, const std::uint64_t offset) const
+{
+	std::byte*  out  = static_cast<std::byte*>(dst);
+	std::size_t done = 0;
+	while (done != nBytes)
+	{
+		const ::ssize_t n = ::pread(m_fd, out + done, nBytes - done, ::off_t(offset + done));
+		if (n < 0 and errno == EINTR) { continue; }
+		if (n < 0)  { throw std::system_error(errno, std::generic_category(), "FSLinalg::IO: pread"); }
+		if (n == 0) { throw std::system_error(std::make_error_code(std::errc::io_error), "FSLinalg::IO: unexpected end of file"); }
+		done += std::size_t(n);
+	}
+}
+
+inline MappedRegion::MappedRegion(const FileDescriptor& file, const std::uint64_t offset, const std::size_t length) : 
+	m_base(nullptr), 
+	m_length(0), 
+	m_data(nullptr)
+{
+	if (length == 0) { return; }
+	
+	// mmap offsets must be page aligned
+	const std::uint64_t pageSize = std::uint64_t(::sysconf(_SC_PAGESIZE));
+	const std::uint64_t start    = offset - offset % pageSize;
+	const std::size_t   shift    = std::size_t(offset - start);
+	
+	void* base = ::mmap(nullptr, length + shift, PROT_READ, MAP_PRIVATE, file.get(), ::off_t(start));
+	if (base == MAP_FAILED) { throw std::system_error(errno, std::generic_category(), "FSLinalg::IO: mmap"); }
+	
+	m_base   = base;
+	m_length = length + shift;
+	m_data   = static_cast<const std::byte*>(base) + shift;
+}
+
+inline MappedRegion::MappedRegion(MappedRegion&& other) noexcept : 
+	m_base  (std::exchange(other.m_base,   nullptr)), 
+	m_length(std::exchange(other.m_length, 0)), 
+	m_data  (std::exchange(other.m_data,   nullptr))
+{}
+
+inline MappedRegion& MappedRegion::operator=(MappedRegion&& other) noexcept
+{
+	if (this != &other)
+	{
+		unmap();
+		m_base   = std::exchange(other.m_base,   nullptr);
+		m_length = std::exchange(other.m_length, 0);
+		m_data   = std::exchange(other.m_data,   nullptr);
+	}
+	return *this;
+}
+
+inline void MappedRegion::adviseSequential() const
+{
+	if (m_base) { ::madvise(m_base, m_length, MADV_SEQUENTIAL); }
+}
+
+inline void MappedRegion::unmap() noexcept
+{
+	if (m_base) { ::munmap(m_base, m_length); }
+	m_base   = nullptr;
+	m_length = 0;
+	m_data   = nullptr;
+}
+
+#else
+
+inline FileDescriptor::FileDescriptor(const std::filesystem::path& path) : 
+	m_stream(path, std::ios::binary), 
+	m_size(0)
+{
+	if (not m_stream) { throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "FSLinalg::IO: cannot open " + path.string()); }
+	m_size = std::uint64_t(std::filesystem::file_size(path));
+}
+
+inline FileDescriptor::~FileDescriptor() = default;
+
+inline std::uint64_t FileDescriptor::fileSize() const
+{
+	return m_size;
+}
+
+inline void FileDescriptor::readAt(void* dst, const std::size_t nBytes, const std::uint64_t offset) const
+{
+	m_stream.clear();
+	m_stream.seekg(std::streamoff(offset));
+	m_stream.read(static_cast<char*>(dst), std::streamsize(nBytes));
+	if (std::size_t(m_stream.gcount()) != nBytes) { throw std::system_error(std::make_error_code(std::errc::io_error), "FSLinalg::IO: unexpected end of file"); }
+}
+
+inline MappedRegion::MappedRegion(const FileDescriptor& file, const std::uint64_t offset, const std::size_t length) : 
+	m_base(nullptr), 
+	m_length(0), 
+	m_data(nullptr)
+{
+	if (length == 0) { return; }
+	
+	// operator new[] aligns the buffer for any scalar type
+	m_buffer.reset(new std::byte[length]);
+	file.readAt(m_buffer.get(), length, offset);
+	
+	m_base   = m_buffer.get();
+	m_length = length;
+	m_data   = m_buffer.get();
+}
+
+inline MappedRegion::MappedRegion(MappedRegion&& other) noexcept : 
+	m_base  (std::exchange(other.m_base,   nullptr)), 
+	m_length(std::exchange(other.m_length, 0)), 
+	m_data  (std::exchange(other.m_data,   nullptr)), 
+	m_buffer(std::move(other.m_buffer))
+{}
+
+inline MappedRegion& MappedRegion::operator=(MappedRegion&& other) noexcept
+{
+	if (this != &other)
+	{
+		m_base   = std::exchange(other.m_base,   nullptr);
+		m_length = std::exchange(other.m_length, 0);
+		m_data   = std::exchange(other.m_data,   nullptr);
+		m_buffer = std::move(other.m_buffer);
+	}
+	return *this;
+}
+
+inline void MappedRegion::adviseSequential() const {}
+
+inline void MappedRegion::unmap() noexcept
+{
+	m_buffer.reset();
+	m_base   = nullptr;
+	m_length = 0;
+	m_data   = nullptr;
+}
+
+#endif
+
+} // namespace detail
+} // namespace IO
+} // namespace FSLinalg
+
+#endif // FSLINALG_IO_MAPPED_REGION_IMPL_HPP
@@ -0,0 +1,59 @@
+#ifndef FSLINALG_IO_TEXT_EXPORT_HPP
+#define FSLINALG_IO_TEXT_EXPORT_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Tensor/TensorBase.hpp>
+
+#include <fmt/format.h>
+
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+/*
+ * Bulk text export of records (CSV by default): one record per line, its entries in row-major order. Floating point 
+ * entries are written with the shortest representation reading back to the same value, complex entries as two 
+ * columns (real and imaginary parts). Everything goes through a single buffer, handed to the stream when it holds more
+ * than flushThreshold bytes and on destruction.
+ */
+class TextExporter
+{
+public:
+	using Size = std::size_t;
+	
+	explicit TextExporter(std::ostream& stream, const std::string_view separator = ",", const Size flushThreshold = Size(1) << 16);
+	~TextExporter() { flush(); }
+	
+	TextExporter(const TextExporter&) = delete;
+	TextExporter& operator=(const TextExporter&) = delete;
+	
+	template<class Expr> void write(const MatrixBase<Expr>& record) requires(Expr::hasReadRandomAccess);
+	template<class Expr> void write(const TensorBase<Expr>& record) requires(Expr::hasReadRandomAccess);
+	
+	template<class Record> void write(std::span<const Record> records);
+	
+	void flush();
+private:
+	template<typename T> void writeEntry(const T& value);
+	
+	void endRecord();
+	
+	std::ostream&      m_stream;
+	std::string        m_separator;
+	Size               m_flushThreshold;
+	fmt::memory_buffer m_buffer;
+};
+
+} // namespace IO
+} // namespace FSLinalg
+
+#include <FSLinalg/IO/TextExport_impl.hpp>
+
+#endif // FSLINALG_IO_TEXT_EXPORT_HPP
@@ -0,0 +1,87 @@
+#ifndef FSLINALG_IO_TEXT_EXPORT_IMPL_HPP
+#define FSLINALG_IO_TEXT_EXPORT_IMPL_HPP
+
+#include <FSLinalg/IO/TextExport.hpp>
+#include <FSLinalg/misc/NestedLoop.hpp>
+
+#include <fmt/compile.h>
+
+namespace FSLinalg
+{
+namespace IO
+{
+
+inline TextExporter::TextExporter(std::ostream& stream, const std::string_view separator, const Size flushThreshold) : 
+	m_stream(stream), 
+	m_separator(separator), 
+	m_flushThreshold(flushThreshold), 
+	m_buffer()
+{}
+
+inline void TextExporter::flush()
+{
+	m_stream.write(m_buffer.data(), std::streamsize(m_buffer.size()));
+	m_buffer.clear();
+}
+
+inline void TextExporter::endRecord()
+{
+	m_buffer.push_back('\n');
+	if (m_buffer.size() >= m_flushThreshold) { flush(); }
+}
+
+template<typename T> 
+void TextExporter::writeEntry(const T& value)
+{
+	if constexpr (IsComplexScalar<T>::value)
+	{
+		writeEntry(value.real());
+		m_buffer.append(m_separator);
+		writeEntry(value.imag());
+	}
+	else
+	{
+		// the default presentation of floating point values is the shortest round trip one
+		fmt::format_to(fmt::appender(m_buffer), FMT_COMPILE("{}"), value);
+	}
+}
+
+template<class Expr> 
+void TextExporter::write(const MatrixBase<Expr>& record) requires(Expr::hasReadRandomAccess)
+{
+	using MatSize = typename Expr::Size;
+	
+	for (MatSize i=0; i!=Expr::nRows; ++i)
+	{
+		for (MatSize j=0; j!=Expr::nCols; ++j)
+		{
+			if (i != 0 or j != 0) { m_buffer.append(m_separator); }
+			writeEntry(record(i,j));
+		}
+	}
+	endRecord();
+}
+
+template<class Expr> 
+void TextExporter::write(const TensorBase<Expr>& record) requires(Expr::hasReadRandomAccess)
+{
+	bool isFirst = true;
+	misc::nestedLoop(Expr::shape, [this, &record, &isFirst](const typename Expr::Shape& index) -> void
+	{
+		if (not isFirst) { m_buffer.append(m_separator); }
+		writeEntry(record(index));
+		isFirst = false;
+	});
+	endRecord();
+}
+
+template<class Record> 
+void TextExporter::write(std::span<const Record> records)
+{
+	for (const Record& record : records) { write(record); }
+}
+
+} // namespace IO
+} // namespace FSLinalg
+
+#endif // FSLINALG_IO_TEXT_EXPORT_IMPL_HPP
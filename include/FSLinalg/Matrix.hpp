@@ -1,7 +1,11 @@
 #include <FSLinalg/Matrix/Formater.hpp>
 #include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/NoAlias.hpp>
 #include <FSLinalg/Matrix/MatrixConj.hpp>
+#include <FSLinalg/Matrix/MatrixCast.hpp>
 #include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/Matrix/MatrixView.hpp>
+#include <FSLinalg/Matrix/MatrixMap.hpp>
 #include <FSLinalg/Matrix/MatrixScale.hpp>
 #include <FSLinalg/Matrix/MatrixSub.hpp>
 #include <FSLinalg/Matrix/MatrixSum.hpp>
@@ -9,16 +13,25 @@
 #include <FSLinalg/Matrix/KeepBrackets.hpp>
 #include <FSLinalg/Matrix/MatrixTransposed.hpp>
 #include <FSLinalg/Matrix/VectorCross.hpp>
+#include <FSLinalg/Matrix/MatrixCongruence.hpp>
 #include <FSLinalg/Matrix/StripSymbolsAndEvalMatrix.hpp>
 #include <FSLinalg/Matrix/UnitMatrix.hpp>
+#include <FSLinalg/Matrix/SkewMatrix.hpp>
+#include <FSLinalg/Matrix/KroneckerProduct.hpp>
+#include <FSLinalg/Matrix/SplitComplexMatrix.hpp>
+#include <FSLinalg/Matrix/QuantizedMatrix.hpp>
 #include <FSLinalg/Matrix/MatrixProductAnalyzer.hpp>
 #include <FSLinalg/Matrix/MatrixProductChain.hpp>
 
 #include <FSLinalg/Matrix/MatrixBase_impl.hpp>
 #include <FSLinalg/Matrix/MatrixConj_impl.hpp>
+#include <FSLinalg/Matrix/MatrixCast_impl.hpp>
 #include <FSLinalg/Matrix/MatrixProduct_impl.hpp>
 #include <FSLinalg/Matrix/Matrix_impl.hpp>
 #include <FSLinalg/Matrix/MatrixTransposed_impl.hpp>
 #include <FSLinalg/Matrix/VectorCross_impl.hpp>
+#include <FSLinalg/Matrix/MatrixCongruence_impl.hpp>
 #include <FSLinalg/Matrix/MatrixProductAnalyzer_impl.hpp>
 #include <FSLinalg/Matrix/MatrixProductChain_impl.hpp>
+#include <FSLinalg/Matrix/SplitComplexMatrix_impl.hpp>
+#include <FSLinalg/Matrix/QuantizedMatrix_impl.hpp>
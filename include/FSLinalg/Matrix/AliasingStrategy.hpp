@@ -0,0 +1,39 @@
+#ifndef FSLINALG_ALIASING_STRATEGY_HPP
+#define FSLINALG_ALIASING_STRATEGY_HPP
+
+namespace FSLinalg
+{
+
+/*
+ * How an assignment whose destination is read by the expression was evaluated.
+ * 
+ * Temporary        : the expression is evaluated in a full temporary, then copied to the destination.
+ * RowBuffer        : dst = dst*B, each row of dst is buffered before being overwritten by its row of the product.
+ * ColumnBuffer     : dst = A*dst, each column of dst is buffered before being overwritten by its column of the product.
+ * InPlaceTranspose : dst = transpose(dst), symmetric entries of the square destination are swapped in place.
+ */
+enum class AliasingStrategy
+{
+	None,
+	Temporary,
+	RowBuffer,
+	ColumnBuffer,
+	InPlaceTranspose
+};
+
+namespace detail
+{
+
+inline thread_local AliasingStrategy lastAliasingStrategy = AliasingStrategy::None;
+
+inline void recordAliasingStrategy(const AliasingStrategy strategy) { lastAliasingStrategy = strategy; }
+
+} // namespace detail
+
+// strategy used by the last assignment run on this thread that found aliasing, None if there was none since the last reset
+inline AliasingStrategy lastAliasingStrategy()  { return detail::lastAliasingStrategy; }
+inline void             resetAliasingStrategy() { detail::lastAliasingStrategy = AliasingStrategy::None; }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_ALIASING_STRATEGY_HPP
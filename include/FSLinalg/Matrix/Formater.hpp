@@ -2,63 +2,70 @@
 #define FSLINALG_MATRIX_FORMATER_HPP
 
 #include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/misc/FormatSpec.hpp>
 
 #include <fmt/core.h>
 
+#include <algorithm>
+#include <string_view>
+
+// the spec is parsed once per call (see misc::FormatSpec), entries are then written by the scalar formatter
 template<FSLinalg::Matrix_concept Expr>
 class fmt::formatter< Expr > : public fmt::formatter< typename FSLinalg::MatrixBase<Expr>::Scalar >
 {
 public:
+	using Base = fmt::formatter< typename FSLinalg::MatrixBase<Expr>::Scalar >;
+	
 	static_assert(Expr::hasReadRandomAccess, "Matrix must have a read random access Iterator");
 	
-	constexpr auto parse(fmt::format_parse_context& ctx) { return ctx.begin(); }
+	template<typename ParseContext>
+	constexpr auto parse(ParseContext& ctx) 
+	{ 
+		m_spec.parse(ctx);
+		return Base::parse(ctx); 
+	}
 	
 	template <typename Context>
 	auto format (const FSLinalg::MatrixBase<Expr>& A, Context& ctx) const 
 	{
 		using Size = typename FSLinalg::MatrixBase<Expr>::Size;
 		
-		const Size rowsM1 = Size(A.getRows()-1);
-		const Size colsM1 = Size(A.getCols()-1);
-		
-		auto out = ctx.out();
+		const auto entry = [this, &ctx](const auto& value) -> void { ctx.advance_to(Base::format(value, ctx)); };
+		const auto text  = [&ctx](const std::string_view str) -> void { ctx.advance_to(std::copy(std::cbegin(str), std::cend(str), ctx.out())); };
 		
 		if constexpr (Expr::isRowVector or Expr::isColVector)
 		{
-			out = format_to(out, "[");
+			text("[");
 			for (Size i=0; i!=Size(A.getSize()-1); ++i)
 			{
-				out = format_to(out, "{}, ", A[i]);
-			}
-			if constexpr (Expr::isRowVector)
-			{
-				return format_to(out, "{}]^T", A[Size(A.getSize()-1)]);
-			}
-			else
-			{
-				return format_to(out, "{}]", A[Size(A.getSize()-1)]);
+				entry(A[i]);
+				text(m_spec.separator);
 			}
+			entry(A[Size(A.getSize()-1)]);
+			text(Expr::isRowVector ? "]^T" : "]");
 		}
 		else
 		{
-			out = format_to(out, "[");
-			for (Size i=0; i!=rowsM1; ++i)
+			// outer loop on rows (or on columns when column-major)
+			const Size nOuter = m_spec.columnMajor ? A.getCols() : A.getRows();
+			const Size nInner = m_spec.columnMajor ? A.getRows() : A.getCols();
+			
+			text("[");
+			for (Size o=0; o!=nOuter; ++o)
 			{
-				out = format_to(out, "[");
-				for (Size j=0; j!=colsM1; ++j)
+				text("[");
+				for (Size i=0; i!=nInner; ++i)
 				{
-					out = format_to(out, "{}, ", A(i,j));
+					entry(m_spec.columnMajor ? A(i,o) : A(o,i));
+					if (i+1 != nInner) { text(m_spec.separator); }
 				}
-				out = format_to(out, "{}]\n", A(i, colsM1));
-			}
-			out = format_to(out, "[");
-			for (Size j=0; j!=colsM1; ++j)
-			{
-				out = format_to(out, "{}, ", A(rowsM1,j));
+				text((o+1 != nOuter) ? "]\n" : "]]");
 			}
-			return format_to(out, "{}]]", A(rowsM1,colsM1));
 		}
+		return ctx.out();
 	}
+private:
+	FSLinalg::misc::FormatSpec m_spec;
 };
 
 #endif // FSLINALG_MATRIX_FORMATER_HPP
@@ -0,0 +1,81 @@
+#ifndef FSLINALG_KRONECKER_PRODUCT_HPP
+#define FSLINALG_KRONECKER_PRODUCT_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+namespace FSLinalg
+{
+
+template<class FactorA, class FactorB> class KroneckerProduct;
+
+template<class FactorA, class FactorB>
+struct MatrixTraits< KroneckerProduct<FactorA, FactorB> >
+{
+	static_assert(IsDenseMatrix<FactorA>::value and IsDenseMatrix<FactorB>::value, "Kronecker factors must be dense matrices");
+	
+	using Scalar = decltype(std::declval<typename FactorA::Scalar>() * std::declval<typename FactorB::Scalar>());
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = (FactorA::nRows*FactorB::nRows == 1) or (FactorA::nCols*FactorB::nCols == 1);
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false; // by-value copies of the factors, which expressions can safely hold
+	
+	static constexpr Size nRows = FactorA::nRows*FactorB::nRows;
+	static constexpr Size nCols = FactorA::nCols*FactorB::nCols;
+};
+
+/*
+ * The Kronecker product A (x) B, whose (i,j) block is A(i,j)*B. Only the factors are stored: products with a
+ * KroneckerProduct operand are computed factor by factor and never expand the full matrix (see StripSymbolsAndEvalMatrix).
+ */
+template<class FactorA, class FactorB>
+class KroneckerProduct : public MatrixBase< KroneckerProduct<FactorA, FactorB> >
+{
+public:
+	using Self = KroneckerProduct<FactorA, FactorB>;
+	FSLINALG_DEFINE_MATRIX
+	
+	using LhsFactor = FactorA;
+	using RhsFactor = FactorB;
+	
+	template<class ExprA, class ExprB>
+	KroneckerProduct(const MatrixBase<ExprA>& a, const MatrixBase<ExprB>& b) : m_lhs(a.derived()), m_rhs(b.derived()) {}
+	
+	const_ReturnType getImpl(const Size i, const Size j) const
+	{
+		return m_lhs(i / FactorB::nRows, j / FactorB::nCols)*m_rhs(i % FactorB::nRows, j % FactorB::nCols);
+	}
+	
+	const_ReturnType getImpl(const Size i) const requires(hasFlatRandomAccess)
+	{
+		if constexpr (isRowVector) { return getImpl(i, 0); }
+		else                       { return getImpl(0, i); }
+	}
+	
+	const FactorA& lhs() const { return m_lhs; }
+	const FactorB& rhs() const { return m_rhs; }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
+private:
+	FactorA m_lhs;
+	FactorB m_rhs;
+};
+
+template<typename Expr>                struct IsKroneckerProduct                                        : BIC::Fixed<bool, false> {};
+template<class FactorA, class FactorB> struct IsKroneckerProduct< KroneckerProduct<FactorA, FactorB> > : BIC::Fixed<bool, true>  {};
+
+template<class ExprA, class ExprB>
+KroneckerProduct< Matrix<typename ExprA::Scalar, ExprA::nRows, ExprA::nCols>, Matrix<typename ExprB::Scalar, ExprB::nRows, ExprB::nCols> >
+kron(const MatrixBase<ExprA>& a, const MatrixBase<ExprB>& b)
+{
+	return KroneckerProduct< Matrix<typename ExprA::Scalar, ExprA::nRows, ExprA::nCols>, Matrix<typename ExprB::Scalar, ExprB::nRows, ExprB::nCols> >(a, b);
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_KRONECKER_PRODUCT_HPP
@@ -2,6 +2,9 @@
 #define FSLINALG_MATRIX_HPP
 
 #include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/NoAlias.hpp>
+#include <FSLinalg/Random.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
 
 #include <array>
 
@@ -9,6 +12,8 @@ namespace FSLinalg
 {
 
 template<typename T, unsigned int Nrows, unsigned Ncols> class Matrix;
+template<typename T, unsigned int Nrows, unsigned Ncols> class MatrixMap;
+template<typename T, unsigned int... dims>               class TensorMap;
 
 template<typename T, unsigned int Nrows, unsigned Ncols>
 struct MatrixTraits< Matrix<T, Nrows, Ncols> >
@@ -26,6 +31,16 @@ struct MatrixTraits< Matrix<T, Nrows, Ncols> >
 	static constexpr Size nCols = Ncols;
 };
 
+// matrices storing their entries contiguously in row-major order, which the product kernels read through data()
+template<typename Expr>                                        struct IsDenseMatrix                                : BIC::Fixed<bool, false> {};
+template<typename T, unsigned int Nrows, unsigned int Ncols> struct IsDenseMatrix< Matrix<T, Nrows, Ncols> >    : BIC::Fixed<bool, true>  {};
+template<typename T, unsigned int Nrows, unsigned int Ncols> struct IsDenseMatrix< MatrixMap<T, Nrows, Ncols> > : BIC::Fixed<bool, true>  {};
+
+template<typename Expr>                                        struct IsMatrixMap                                : BIC::Fixed<bool, false> {};
+template<typename T, unsigned int Nrows, unsigned int Ncols> struct IsMatrixMap< MatrixMap<T, Nrows, Ncols> > : BIC::Fixed<bool, true>  {};
+
+template<typename Expr, unsigned int Nrows, unsigned int Ncols> concept DenseMatrix_concept = IsDenseMatrix<Expr>::value and Expr::nRows == Nrows and Expr::nCols == Ncols;
+
 template<typename T, unsigned int Nrows, unsigned Ncols> 
 class Matrix : public MatrixBase< Matrix<T, Nrows, Ncols> >
 {
@@ -33,11 +48,11 @@ public:
 	using Self = Matrix<T, Nrows, Ncols>;
 	FSLINALG_DEFINE_MATRIX
 	
+	// maps of this matrix may reshape it, dense destinations are compared by storage
 	template<class Dst>
 	struct CanBeAlisaedTo : BIC::Fixed<bool,  
 		    IsMatrix<Dst>::value 
-		and Base::nRows == Dst::nRows
-		and Base::nCols == Dst::nCols
+		and ((Base::nRows == Dst::nRows and Base::nCols == Dst::nCols) or IsMatrixMap<Dst>::value)
 		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
 	
 	static constexpr bool isScalarComplex = IsComplexScalar<Scalar>::value;
@@ -53,6 +68,8 @@ public:
 	
 	Matrix(const Matrix& other) : m_data(other.m_data) {}
 	
+	Matrix& operator=(const Matrix& other) { m_data = other.m_data; return *this; }
+	
 	template<class Expr> Matrix(const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.assignTo(BIC::fixed<bool, false>, BIC::fixed<RealScalar, RealScalar(1)>, *this); }
 	
 	template<class Expr> Matrix& operator= (const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.assignTo  (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
@@ -67,19 +84,38 @@ public:
 	
 	void setZero() { m_data.fill(Scalar(0)); }
 	
+	// assignments through noalias() skip the aliasing checks
+	NoAlias<Matrix> noalias() { return NoAlias<Matrix>(*this); }
+	
+	const Scalar* data() const { return m_data.data(); }
+	      Scalar* data()       { return m_data.data(); }
+	
+	// views of the entries as a Nrows x Ncols tensor, or reshaped to dims (see TensorMap)
+	TensorMap<const Scalar, Nrows, Ncols> asTensor() const { return TensorMap<const Scalar, Nrows, Ncols>(data()); }
+	TensorMap<      Scalar, Nrows, Ncols> asTensor()       { return TensorMap<      Scalar, Nrows, Ncols>(data()); }
+	
+	template<unsigned int... dims> TensorMap<const Scalar, dims...> asTensor() const requires(sizeof...(dims) != 0 and (1u * ... * dims) == size) { return TensorMap<const Scalar, dims...>(data()); }
+	template<unsigned int... dims> TensorMap<      Scalar, dims...> asTensor()       requires(sizeof...(dims) != 0 and (1u * ... * dims) == size) { return TensorMap<      Scalar, dims...>(data()); }
+	
 	const_ReturnType getImpl(const Size i) const { return m_data[i]; }
 	      ReturnType getImpl(const Size i)       { return m_data[i]; }
 	      
 	const_ReturnType getImpl(const Size i, const Size j) const { return m_data[i*nCols + j]; }
 	      ReturnType getImpl(const Size i, const Size j)       { return m_data[i*nCols + j]; }
 	      
-	template<class Dst>           bool isAliasedToImpl(const MatrixBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return std::addressof(dst.derived()) == this; }
+	template<class Dst>           bool isAliasedToImpl(const MatrixBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) 
+	{ 
+		if constexpr (IsDenseMatrix<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+		else                                     { return std::addressof(dst.derived()) == this;                          }
+	}
 	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
 	
 	static Matrix zero()   { return Matrix(RealScalar(0)); }
 	static Matrix ones()   { return Matrix(RealScalar(1)); }
 	
-	static Matrix random(const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1));
+	// uniform entries in [lb, ub), real and imaginary parts drawn independently for complex scalars
+	static Matrix random(RandomEngine& engine, const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1));
+	static Matrix random(const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1)) { return random(RandomEngine::threadLocal(), lb, ub); }
 private:
 	std::array<Scalar, size> m_data;
 };
@@ -4,6 +4,7 @@
 #include <FSLinalg/CRTPBase.hpp>
 #include <FSLinalg/Scalar.hpp>
 #include <FSLinalg/misc/Logical.hpp>
+#include <FSLinalg/Matrix/AliasingStrategy.hpp>
 
 namespace FSLinalg
 {
@@ -72,6 +73,9 @@ public:
 
 template<typename Expr> struct IsMatrix : BIC::Fixed<bool,  std::is_base_of<MatrixBase<Expr>, Expr>::value > {};
 
+// transposition of a leaf, which can be assigned to its own leaf by swapping entries in place
+template<typename Expr> struct IsLeafTransposition : BIC::Fixed<bool, false> {};
+
 template<typename Expr> concept Matrix_concept         = IsMatrix<Expr>::value;
 template<typename Expr> concept ReadableMatrix_concept = IsMatrix<Expr>::value and Expr::hasReadRandomAccess;
 template<typename Expr> concept WritableMatrix_concept = IsMatrix<Expr>::value and Expr::hasWriteRandomAccess;
@@ -7,6 +7,31 @@
 namespace FSLinalg
 {
 
+namespace detail
+{
+
+// dst = op(dst, alpha*transpose(dst)) for a square dst, without temporary
+template<typename Alpha, class Dst, class Op>
+void transposeInPlace(const Alpha& alpha, MatrixBase<Dst>& dst, const Op& op)
+{
+	using Size   = typename Dst::Size;
+	using Scalar = typename Dst::Scalar;
+	
+	for (Size i=0; i!=Dst::nRows; ++i)
+	{
+		op(dst(i,i), alpha*dst(i,i));
+		for (Size j=i+1; j!=Dst::nCols; ++j)
+		{
+			const Scalar a = dst(i,j);
+			const Scalar b = dst(j,i);
+			op(dst(i,j), alpha*b);
+			op(dst(j,i), alpha*a);
+		}
+	}
+}
+
+} // namespace detail
+
 template<class Derived> template<typename Bool, typename Alpha, class Dst>
 void MatrixBase<Derived>::assignTo(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
 {
@@ -15,29 +40,41 @@ void MatrixBase<Derived>::assignTo(const Bool checkAliasing, const Alpha& alpha,
 	
 	if constexpr (hasReadRandomAccess)
 	{
-		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
+		if constexpr (causesAliasingIssues and Derived::template CanBeAlisaedTo<Dst>::value)
 		{
-			Matrix<Scalar, nRows, nCols> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
+			if (checkAliasing and isAliasedTo(dst))
 			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*tmp[i]; }
-			}
-			else
-			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) = alpha*tmp(i,j); }}
+				if constexpr (IsLeafTransposition<Derived>::value and nRows == nCols)
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::InPlaceTranspose);
+					detail::transposeInPlace(alpha, dst, [](auto& lhs, const auto& rhs) -> void { lhs = rhs; });
+				}
+				else
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::Temporary);
+					
+					Matrix<Scalar, nRows, nCols> tmp(*this);
+					
+					if constexpr (hasFlatRandomAccess)
+					{
+						for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*tmp[i]; }
+					}
+					else
+					{
+						for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) = alpha*tmp(i,j); }}
+					}
+				}
+				return;
 			}
 		}
+		
+		if constexpr (hasFlatRandomAccess)
+		{
+			for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*CRTP::derived().getImpl(i); }
+		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) = alpha*CRTP::derived().getImpl(i,j); }}
-			}
+			for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) = alpha*CRTP::derived().getImpl(i,j); }}
 		}
 	}
 	else
@@ -54,29 +91,41 @@ void MatrixBase<Derived>::increment(const Bool checkAliasing, const Alpha& alpha
 	
 	if constexpr (hasReadRandomAccess)
 	{
-		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
+		if constexpr (causesAliasingIssues and Derived::template CanBeAlisaedTo<Dst>::value)
 		{
-			Matrix<Scalar, nRows, nCols> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*tmp[i]; }
-			}
-			else
+			if (checkAliasing and isAliasedTo(dst))
 			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) += alpha*tmp(i,j); }}
+				if constexpr (IsLeafTransposition<Derived>::value and nRows == nCols)
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::InPlaceTranspose);
+					detail::transposeInPlace(alpha, dst, [](auto& lhs, const auto& rhs) -> void { lhs += rhs; });
+				}
+				else
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::Temporary);
+					
+					Matrix<Scalar, nRows, nCols> tmp(*this);
+					
+					if constexpr (hasFlatRandomAccess)
+					{
+						for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*tmp[i]; }
+					}
+					else
+					{
+						for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) += alpha*tmp(i,j); }}
+					}
+				}
+				return;
 			}
 		}
+		
+		if constexpr (hasFlatRandomAccess)
+		{
+			for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*CRTP::derived().getImpl(i); }
+		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) += alpha*CRTP::derived().getImpl(i,j); }}
-			}
+			for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) += alpha*CRTP::derived().getImpl(i,j); }}
 		}
 	}
 	else
@@ -93,29 +142,41 @@ void MatrixBase<Derived>::decrement(const Bool checkAliasing, const Alpha& alpha
 	
 	if constexpr (hasReadRandomAccess)
 	{
-		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
+		if constexpr (causesAliasingIssues and Derived::template CanBeAlisaedTo<Dst>::value)
 		{
-			Matrix<Scalar, nRows, nCols> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
+			if (checkAliasing and isAliasedTo(dst))
 			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*tmp[i]; }
-			}
-			else
-			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) -= alpha*tmp(i,j); }}
+				if constexpr (IsLeafTransposition<Derived>::value and nRows == nCols)
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::InPlaceTranspose);
+					detail::transposeInPlace(alpha, dst, [](auto& lhs, const auto& rhs) -> void { lhs -= rhs; });
+				}
+				else
+				{
+					detail::recordAliasingStrategy(AliasingStrategy::Temporary);
+					
+					Matrix<Scalar, nRows, nCols> tmp(*this);
+					
+					if constexpr (hasFlatRandomAccess)
+					{
+						for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*tmp[i]; }
+					}
+					else
+					{
+						for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) -= alpha*tmp(i,j); }}
+					}
+				}
+				return;
 			}
 		}
+		
+		if constexpr (hasFlatRandomAccess)
+		{
+			for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*CRTP::derived().getImpl(i); }
+		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) -= alpha*CRTP::derived().getImpl(i,j); }}
-			}
+			for (Size i=0; i!=getRows(); ++i) { for (Size j=0; j!=getCols(); ++j) { dst(i,j) -= alpha*CRTP::derived().getImpl(i,j); }}
 		}
 	}
 	else
@@ -137,7 +198,7 @@ bool operator==(const FSLinalg::MatrixBase<Lhs>& lhs, const FSLinalg::MatrixBase
 	{
 		for (Size i=0; i!=Lhs::size; ++i)
 		{
-			areEquals = areEquals and (lhs[i] == rhs[i]);
+			areEquals = areEquals and all(lhs[i] == rhs[i]);
 		}
 
 	}
@@ -147,7 +208,7 @@ bool operator==(const FSLinalg::MatrixBase<Lhs>& lhs, const FSLinalg::MatrixBase
 		{
 			for (Size j=0; j!=Lhs::nCols; ++j)
 			{
-				areEquals = areEquals and (lhs(i,j) == rhs(i,j));
+				areEquals = areEquals and all(lhs(i,j) == rhs(i,j));
 			}
 		}
 	}
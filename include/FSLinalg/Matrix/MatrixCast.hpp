@@ -0,0 +1,73 @@
+#ifndef FSLINALG_MATRIX_CAST_HPP
+#define FSLINALG_MATRIX_CAST_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+
+namespace FSLinalg
+{
+
+template<class GeneralMatrix>       class StripSymbolsAndEvalMatrix;
+template<Scalar_concept U, class Expr> class MatrixCast;
+	
+template<Scalar_concept U, class Expr> 
+struct MatrixTraits< MatrixCast<U, Expr> >
+{
+	static_assert(IsMatrix<Expr>::value, "Expr must be a Matrix");
+		
+	using Scalar = U;
+	using Size   = typename Expr::Size;
+	
+	static constexpr bool hasReadRandomAccess  = Expr::hasReadRandomAccess;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = Expr::hasFlatRandomAccess;
+	static constexpr bool causesAliasingIssues = Expr::causesAliasingIssues;
+	static constexpr bool isLeaf               = false;
+	
+	static constexpr Size nRows = Expr::nRows;   
+	static constexpr Size nCols = Expr::nCols;   
+};
+
+/*
+ * Converts the elements of Expr to U without materializing the result.
+ * A widening cast evaluates Expr directly in the destination, so products of a cast leaf are computed and accumulated in U.
+ * A narrowing cast evaluates Expr in its own precision and rounds once when storing.
+ */
+template<Scalar_concept U, class Expr> 
+class MatrixCast : public MatrixBase< MatrixCast<U, Expr> >
+{
+public:
+	using Self = MatrixCast<U, Expr>;
+	FSLINALG_DEFINE_MATRIX
+	
+	friend class StripSymbolsAndEvalMatrix<Self>;
+	
+	static constexpr bool isWidening = std::is_same<typename PromoteTraits<typename Expr::Scalar, RealScalar>::Type, U>::value;
+	
+	MatrixCast(const MatrixBase<Expr>& expr) : m_expr(expr.derived()) {}
+	
+	const_ReturnType getImpl(const Size i, const Size j) const requires(hasReadRandomAccess)  { return static_cast<U>(m_expr.getImpl(i,j)); }
+	
+	const_ReturnType getImpl(const Size i) const requires(hasReadRandomAccess and hasFlatRandomAccess) { return static_cast<U>(m_expr.getImpl(i)); }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Expr::template CanBeAlisaedTo<Dst>::value> {};
+	
+	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
+
+	template<typename Bool, typename Alpha, class Dst>
+	void assignToImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void incrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void decrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+private:
+	std::conditional_t<Expr::isLeaf, const Expr&, Expr> m_expr;
+};
+
+template<Scalar_concept U, class Expr> 
+FSLinalg::MatrixCast<U, Expr> cast(const FSLinalg::MatrixBase<Expr>& expr) { return FSLinalg::MatrixCast<U, Expr>(expr); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_CAST_HPP
@@ -0,0 +1,54 @@
+#ifndef FSLINALG_MATRIX_CAST_IMPL_HPP
+#define FSLINALG_MATRIX_CAST_IMPL_HPP
+
+#include <FSLinalg/Matrix/MatrixCast.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+namespace FSLinalg
+{
+
+template<Scalar_concept U, class Expr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCast<U,Expr>::assignToImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	if constexpr (isWidening)
+	{
+		m_expr.assignTo(checkAliasing, alpha, dst);
+	}
+	else
+	{
+		const Matrix<typename Expr::Scalar, nRows, nCols> tmp(m_expr);
+		for (Size i=0; i!=size; ++i) { dst[i] = alpha*static_cast<U>(tmp[i]); }
+	}
+}
+	
+template<Scalar_concept U, class Expr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCast<U,Expr>::incrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	if constexpr (isWidening)
+	{
+		m_expr.increment(checkAliasing, alpha, dst);
+	}
+	else
+	{
+		const Matrix<typename Expr::Scalar, nRows, nCols> tmp(m_expr);
+		for (Size i=0; i!=size; ++i) { dst[i] += alpha*static_cast<U>(tmp[i]); }
+	}
+}
+	
+template<Scalar_concept U, class Expr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCast<U,Expr>::decrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	if constexpr (isWidening)
+	{
+		m_expr.decrement(checkAliasing, alpha, dst);
+	}
+	else
+	{
+		const Matrix<typename Expr::Scalar, nRows, nCols> tmp(m_expr);
+		for (Size i=0; i!=size; ++i) { dst[i] -= alpha*static_cast<U>(tmp[i]); }
+	}
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_CAST_IMPL_HPP
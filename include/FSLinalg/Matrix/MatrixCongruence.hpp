@@ -0,0 +1,74 @@
+#ifndef FSLINALG_MATRIX_CONGRUENCE_HPP
+#define FSLINALG_MATRIX_CONGRUENCE_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+
+namespace FSLinalg
+{
+
+template<class BExpr, class DExpr> class MatrixCongruence;
+
+template<class BExpr, class DExpr>
+struct MatrixTraits< MatrixCongruence<BExpr, DExpr> >
+{	
+	static_assert(IsMatrix<BExpr>::value and IsMatrix<DExpr>::value, "Both B and D must be matrices");
+	static_assert(DExpr::nRows == DExpr::nCols, "D must be square");
+	static_assert(BExpr::nRows == DExpr::nRows, "Matrices sizes must match");
+	
+	using Scalar = decltype(conj(std::declval<typename BExpr::Scalar>()) * std::declval<typename DExpr::Scalar>() * std::declval<typename BExpr::Scalar>());
+	using Size   = std::common_type_t<typename BExpr::Size, typename DExpr::Size>;
+
+	static constexpr bool hasReadRandomAccess  = false;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = false;
+	static constexpr bool causesAliasingIssues = true;
+	static constexpr bool isLeaf               = false;
+	
+	static constexpr Size nRows = BExpr::nCols;   
+	static constexpr Size nCols = BExpr::nCols;  
+};
+
+/*
+ * B^H * D * B for a symmetric (hermitian when complex) D. Each column of D*B is computed once into an nRows(B) buffer
+ * and only the upper triangle of the result is reduced, the lower triangle being its (conjugated) mirror. 
+ * Neither D*B nor B^H*D is ever materialized.
+ */
+template<class BExpr, class DExpr>
+class MatrixCongruence : public MatrixBase< MatrixCongruence<BExpr,DExpr> >
+{
+public:
+	using Self = MatrixCongruence<BExpr,DExpr>;
+	FSLINALG_DEFINE_MATRIX
+	
+	MatrixCongruence(const MatrixBase<BExpr>& b, const MatrixBase<DExpr>& d) : m_b(b.derived()), m_d(d.derived()) {}
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, BExpr::template CanBeAlisaedTo<Dst>::value or DExpr::template CanBeAlisaedTo<Dst>::value> {};
+	
+	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& dst) const { return m_b.isAliasedToImpl(dst) or m_d.isAliasedToImpl(dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void assignToImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void incrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void decrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value);
+private:
+	std::conditional_t<BExpr::isLeaf, const BExpr&, BExpr> m_b;
+	std::conditional_t<DExpr::isLeaf, const DExpr&, DExpr> m_d;
+	
+	using TmpB = std::conditional_t<BExpr::hasReadRandomAccess, const BExpr&, Matrix<typename BExpr::Scalar, BExpr::nRows, BExpr::nCols> >;
+	using TmpD = std::conditional_t<DExpr::hasReadRandomAccess, const DExpr&, Matrix<typename DExpr::Scalar, DExpr::nRows, DExpr::nCols> >;
+	
+	template<bool incrDst, typename Alpha, class Dst> static void run(const Alpha& alpha, const std::decay_t<TmpB>& b, const std::decay_t<TmpD>& d, Dst& dst);
+	
+	template<bool incrDst, typename Bool, typename Alpha, class Dst> void apply(const Bool checkAliasing, const Alpha& alpha, Dst& dst) const;
+};
+
+template<class BExpr, class DExpr> requires(DExpr::nRows == DExpr::nCols and BExpr::nRows == DExpr::nRows)
+MatrixCongruence<BExpr, DExpr> congruence(const MatrixBase<BExpr>& b, const MatrixBase<DExpr>& d) { return MatrixCongruence<BExpr, DExpr>(b, d); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_CONGRUENCE_HPP
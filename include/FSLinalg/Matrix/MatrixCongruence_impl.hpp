@@ -0,0 +1,108 @@
+#ifndef FSLINALG_MATRIX_CONGRUENCE_IMPL_HPP
+#define FSLINALG_MATRIX_CONGRUENCE_IMPL_HPP
+
+#include <FSLinalg/Matrix/MatrixCongruence.hpp>
+#include <FSLinalg/Matrix/AliasingStrategy.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+
+#include <array>
+
+namespace FSLinalg
+{
+
+template<class BExpr, class DExpr> template<bool incrDst, typename Alpha, class Dst>
+void MatrixCongruence<BExpr, DExpr>::run(const Alpha& alpha, const std::decay_t<TmpB>& b, const std::decay_t<TmpD>& d, Dst& dst)
+{
+	using Accumulator = typename AccumulatorTraits<Scalar>::Type;
+	using RealAcc     = typename NumTraits<Accumulator>::Real;
+	using BScalar     = typename PromoteTraits<typename BExpr::Scalar, RealAcc>::Type;
+	using DScalar     = typename PromoteTraits<typename DExpr::Scalar, RealAcc>::Type;
+	
+	constexpr Size m = BExpr::nRows;
+	constexpr Size n = BExpr::nCols;
+	
+	constexpr BasicLinalg::MultiplyAdd<false,false> madd;
+	constexpr BasicLinalg::MultiplyAdd<true,false>  cmadd;
+	
+	std::array<Accumulator, m> db;
+	
+	for (Size j=0; j!=n; ++j)
+	{
+		for (Size k=0; k!=m; ++k)
+		{
+			Accumulator acc(RealAcc(0));
+			for (Size l=0; l!=m; ++l) { acc = static_cast<Accumulator>(madd(static_cast<DScalar>(d(k,l)), static_cast<BScalar>(b(l,j)), acc)); }
+			db[k] = acc;
+		}
+		
+		for (Size i=0; i<=j; ++i)
+		{
+			Accumulator acc(RealAcc(0));
+			for (Size k=0; k!=m; ++k) { acc = static_cast<Accumulator>(cmadd(static_cast<BScalar>(b(k,i)), db[k], acc)); }
+			
+			// the unscaled result is hermitian, alpha may not be real
+			if constexpr (incrDst)
+			{
+				dst(i,j) += alpha*acc;
+				if (i != j) { dst(j,i) += alpha*conj(acc); }
+			}
+			else
+			{
+				dst(i,j) = alpha*acc;
+				if (i != j) { dst(j,i) = alpha*conj(acc); }
+			}
+		}
+	}
+}
+
+template<class BExpr, class DExpr> template<bool incrDst, typename Bool, typename Alpha, class Dst>
+void MatrixCongruence<BExpr, DExpr>::apply(const Bool checkAliasing, const Alpha& alpha, Dst& dst) const
+{
+	TmpB b(m_b);
+	TmpD d(m_d);
+	
+	if constexpr (CanBeAlisaedTo<Dst>::value)
+	{
+		if (checkAliasing and (b.isAliasedTo(dst) or d.isAliasedTo(dst)))
+		{
+			detail::recordAliasingStrategy(AliasingStrategy::Temporary);
+			
+			Matrix<typename Dst::Scalar, nRows, nCols> tmp(typename Dst::Scalar(0));
+			run<false>(alpha, b, d, tmp);
+			
+			for (Size i=0; i!=nRows; ++i)
+			{
+				for (Size j=0; j!=nCols; ++j)
+				{
+					if constexpr (incrDst) { dst(i,j) += tmp(i,j); }
+					else                   { dst(i,j)  = tmp(i,j); }
+				}
+			}
+			return;
+		}
+	}
+	
+	run<incrDst>(alpha, b, d, dst);
+}
+
+template<class BExpr, class DExpr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCongruence<BExpr, DExpr>::assignToImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{	
+	apply<false>(checkAliasing, alpha, dst.derived());
+}
+
+template<class BExpr, class DExpr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCongruence<BExpr, DExpr>::incrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	apply<true>(checkAliasing, alpha, dst.derived());
+}
+
+template<class BExpr, class DExpr> template<typename Bool, typename Alpha, class Dst>
+void MatrixCongruence<BExpr, DExpr>::decrementImpl(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
+{
+	apply<true>(checkAliasing, -alpha, dst.derived());
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_CONGRUENCE_IMPL_HPP
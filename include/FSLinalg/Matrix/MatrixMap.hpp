@@ -0,0 +1,95 @@
+#ifndef FSLINALG_MATRIX_MAP_HPP
+#define FSLINALG_MATRIX_MAP_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/Matrix/NoAlias.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int Nrows, unsigned Ncols>
+struct MatrixTraits< MatrixMap<T, Nrows, Ncols> >
+{
+	using Scalar = std::remove_const_t<T>;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = not std::is_const<T>::value;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = true;
+	
+	static constexpr Size nRows = Nrows;
+	static constexpr Size nCols = Ncols;
+};
+
+/*
+ * Matrix over Nrows*Ncols row-major scalars owned elsewhere (a Tensor, see Tensor::asMatrix()), read-only for a const T.
+ * Unlike MatrixView, a map is a leaf: the product kernels use its storage in place, and expressions hold it by reference
+ * so that it must outlive them, like a Matrix. Assignments write through the map, they never rebind it.
+ */
+template<typename T, unsigned int Nrows, unsigned Ncols>
+class MatrixMap : public MatrixBase< MatrixMap<T, Nrows, Ncols> >
+{
+public:
+	using Self = MatrixMap<T, Nrows, Ncols>;
+	FSLINALG_DEFINE_MATRIX
+	
+	// other maps of the same storage may reshape it, dense destinations are compared by storage
+	template<class Dst>
+	struct CanBeAlisaedTo : BIC::Fixed<bool,
+		    IsDenseMatrix<Dst>::value
+		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
+	
+	static constexpr bool isScalarComplex = IsComplexScalar<Scalar>::value;
+	
+	explicit MatrixMap(T* data) : m_data(data) {}
+	
+	MatrixMap(const MatrixMap& other) = default;
+	
+	MatrixMap& operator=(const MatrixMap& other) requires(hasWriteRandomAccess) { other.assignTo(BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	
+	template<class Expr> MatrixMap& operator= (const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.assignTo  (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> MatrixMap& operator+=(const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.increment (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> MatrixMap& operator-=(const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.decrement (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	
+	MatrixMap& operator*=(const RealScalar& alpha) requires(hasWriteRandomAccess and isScalarComplex) { for (Size i=0; i!=size; ++i) { m_data[i] *= alpha; } return *this; }
+	MatrixMap& operator/=(const RealScalar& alpha) requires(hasWriteRandomAccess and isScalarComplex) { for (Size i=0; i!=size; ++i) { m_data[i] /= alpha; } return *this; }
+	
+	MatrixMap& operator*=(const Scalar& alpha) requires(hasWriteRandomAccess) { for (Size i=0; i!=size; ++i) { m_data[i] *= alpha; } return *this; }
+	MatrixMap& operator/=(const Scalar& alpha) requires(hasWriteRandomAccess) { for (Size i=0; i!=size; ++i) { m_data[i] /= alpha; } return *this; }
+	
+	void setZero() requires(hasWriteRandomAccess) { std::fill_n(m_data, size, Scalar(0)); }
+	
+	// assignments through noalias() skip the aliasing checks
+	NoAlias<MatrixMap> noalias() requires(hasWriteRandomAccess) { return NoAlias<MatrixMap>(*this); }
+	
+	const Scalar* data() const { return m_data; }
+	      T*      data()       { return m_data; }
+	
+	TensorMap<const Scalar, Nrows, Ncols> asTensor() const { return TensorMap<const Scalar, Nrows, Ncols>(m_data); }
+	TensorMap<      T,      Nrows, Ncols> asTensor()       { return TensorMap<      T,      Nrows, Ncols>(m_data); }
+	
+	template<unsigned int... dims> TensorMap<const Scalar, dims...> asTensor() const requires(sizeof...(dims) != 0 and (1u * ... * dims) == size) { return TensorMap<const Scalar, dims...>(m_data); }
+	template<unsigned int... dims> TensorMap<      T,      dims...> asTensor()       requires(sizeof...(dims) != 0 and (1u * ... * dims) == size) { return TensorMap<      T,      dims...>(m_data); }
+	
+	const_ReturnType getImpl(const Size i) const                               { return m_data[i]; }
+	      ReturnType getImpl(const Size i)       requires(hasWriteRandomAccess) { return m_data[i]; }
+	
+	const_ReturnType getImpl(const Size i, const Size j) const                               { return m_data[i*nCols + j]; }
+	      ReturnType getImpl(const Size i, const Size j)       requires(hasWriteRandomAccess) { return m_data[i*nCols + j]; }
+	
+	template<class Dst>           bool isAliasedToImpl(const MatrixBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
+private:
+	T* m_data;
+};
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_MAP_HPP
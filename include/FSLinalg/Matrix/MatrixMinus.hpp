@@ -44,6 +44,8 @@ public:
 
 	const_ReturnType getImpl(const Size i) const requires(hasReadRandomAccess and hasFlatRandomAccess) { return -m_expr.getImpl(i); }
 	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Expr::template CanBeAlisaedTo<Dst>::value> {};
+	
 	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
 
 	template<typename Bool, typename Alpha, class Dst>
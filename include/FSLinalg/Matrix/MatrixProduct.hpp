@@ -19,6 +19,9 @@ template<class Expr> struct MatrixProductAnalyzerImpl;
 template<class Lhs, class Rhs> class MatrixProduct;
 template<class Expr>           class KeepBrackets;
 
+template<typename T, unsigned int Nrows, unsigned int Ncols>   class SplitComplexMatrix;
+template<typename Int, unsigned int Nrows, unsigned int Ncols> class QuantizedMatrix;
+
 template<class Lhs, class Rhs>
 struct MatrixTraits< MatrixProduct<Lhs, Rhs> >
 {
@@ -47,6 +50,8 @@ public:
 	
 	friend struct detail::MatrixProductAnalyzerImpl< Self >;
 	friend class KeepBrackets< Self >;
+	template<typename, unsigned int, unsigned int> friend class SplitComplexMatrix;
+	template<typename, unsigned int, unsigned int> friend class QuantizedMatrix;
 	
 	MatrixProduct(const MatrixBase<Lhs>& lhs, const MatrixBase<Rhs>& rhs) : m_lhs(lhs.derived()), m_rhs(rhs.derived()) {}
 	
@@ -61,6 +66,8 @@ public:
 	 */
 	const_ReturnType getImpl(const Size i, const Size j) const requires(hasReadRandomAccess)  { return m_lhs.getImpl(i)*m_rhs.getImpl(j); }
 	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Lhs::template CanBeAlisaedTo<Dst>::value or Rhs::template CanBeAlisaedTo<Dst>::value> {};
+	
 	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& other) const { return m_lhs.isAliasedToImpl(other) or m_rhs.isAliasedToImpl(other); }
 
 	template<typename Bool, typename Alpha, class Dst>
@@ -94,6 +101,14 @@ private:
 	
 	static constexpr unsigned int RhsNRows = StripSymbolsAndEvalMatrix<Rhs>::nRows;
 	static constexpr unsigned int RhsNCols = StripSymbolsAndEvalMatrix<Rhs>::nCols;
+	
+	// dst = A*B only needs one row of A at a time, dst = A*B one column of B at a time
+	static constexpr bool canBufferRows    = not isLhsTransposed and IsDenseMatrix<StrippedLhs>::value and IsDenseMatrix<StrippedRhs>::value;
+	static constexpr bool canBufferColumns = not isRhsTransposed and IsDenseMatrix<StrippedLhs>::value and IsDenseMatrix<StrippedRhs>::value;
+	
+	// dst = beta*A*B, or dst += beta*A*B when incrDst is set, with dst being A or B
+	template<bool incrDst, typename Beta, class Dst>
+	static void runAliased(const Beta& beta, const StrippedLhs& A, const StrippedRhs& B, Dst& dst);
 
 	std::conditional_t<Lhs::isLeaf, const Lhs&, Lhs> m_lhs;
 	std::conditional_t<Rhs::isLeaf, const Rhs&, Rhs> m_rhs;
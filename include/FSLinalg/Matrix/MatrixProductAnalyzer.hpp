@@ -7,6 +7,8 @@
 #include <BIC/Core.hpp>
 
 #include <FSLinalg/Matrix/MatrixProductChain.hpp>
+#include <FSLinalg/Matrix/SkewMatrix.hpp>
+#include <FSLinalg/Matrix/KroneckerProduct.hpp>
 
 namespace FSLinalg
 {
@@ -71,7 +73,9 @@ struct MatrixProductAnalyzer
 	static_assert(IsMatrix<Expr>::value, "Expr must be a matrix");
 	
 	using Impl = detail::MatrixProductAnalyzerImpl<Expr>;
-	using DimArray = std::array<size_t, Impl::length+1>;
+	using DimArray  = std::array<size_t, Impl::length+1>;
+	using SkewArray = std::array<bool, Impl::length>;
+	using KronArray = std::array<std::array<size_t, 2>, Impl::length>;
 	
 	template<size_t n> using NthMatrix = typename Impl::template NthMatrix<n>;
 	
@@ -80,18 +84,20 @@ struct MatrixProductAnalyzer
 	
 	static constexpr size_t getLength() { return Impl::length; }
 	
-	static constexpr DimArray getDims();
+	static constexpr DimArray  getDims();
+	static constexpr SkewArray getSkewFactors();
+	static constexpr KronArray getKroneckerFactors();
 	
 	// we use an external template class as to not recompute everything for every product
 	// if the optimal splitting for an chain with the same dims has already been computed 
 	// we can re-use it.
-	static constexpr size_t getOptimalCost  () { return MatrixProductChain<getDims()>::template minCostAndSplit<0, getLength()>.first;  }
-	static constexpr size_t getOptimalSplit () { return MatrixProductChain<getDims()>::template minCostAndSplit<0, getLength()>.second; }
+	static constexpr size_t getOptimalCost  () { return MatrixProductChain<getDims(), getSkewFactors(), getKroneckerFactors()>::template minCostAndSplit<0, getLength()>.first;  }
+	static constexpr size_t getOptimalSplit () { return MatrixProductChain<getDims(), getSkewFactors(), getKroneckerFactors()>::template minCostAndSplit<0, getLength()>.second; }
 private:
 	template<size_t start, size_t end> requires(start <= end and end <= getLength())
 	struct OptimalBracketingHelper
 	{
-		static constexpr size_t split = MatrixProductChain<getDims()>::template minCostAndSplit<start, end>.second;
+		static constexpr size_t split = MatrixProductChain<getDims(), getSkewFactors(), getKroneckerFactors()>::template minCostAndSplit<start, end>.second;
 		
 		static_assert(start <= split and split+1 < end+1, "invalid split");
 		
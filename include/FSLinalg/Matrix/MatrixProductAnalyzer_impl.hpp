@@ -57,6 +57,29 @@ constexpr auto MatrixProductAnalyzer<Expr>::getDims() -> DimArray
 	return dims; 
 }
 
+template<class Expr>
+constexpr auto MatrixProductAnalyzer<Expr>::getSkewFactors() -> SkewArray
+{
+	SkewArray skewFactors{};
+	BIC::foreach(BIC::fixed<size_t, 0>, BIC::fixed<size_t, getLength()>, [&skewFactors](const auto n) -> void
+	{
+		skewFactors[n] = IsSkewMatrix< NthMatrix<n> >::value;
+	});
+	return skewFactors;
+}
+
+template<class Expr>
+constexpr auto MatrixProductAnalyzer<Expr>::getKroneckerFactors() -> KronArray
+{
+	KronArray kronFactors{};
+	BIC::foreach(BIC::fixed<size_t, 0>, BIC::fixed<size_t, getLength()>, [&kronFactors](const auto n) -> void
+	{
+		using Factor = NthMatrix<n>;
+		if constexpr (IsKroneckerProduct<Factor>::value) { kronFactors[n] = {Factor::LhsFactor::nRows, Factor::LhsFactor::nCols}; }
+	});
+	return kronFactors;
+}
+
 } // namespace FSLinalg
 
 #endif // FSLINALG_MATRIX_PRODUCT_TRAITS_IMPL_HPP
@@ -8,9 +8,25 @@
 namespace FSLinalg
 {
 
-template<std::array dims> 
+/*
+ * Optimal bracketing of the chain of matrices i, of size dims[i] x dims[i+1]. 
+ * skewFactors[i] flags the SkewMatrix factors, whose products are computed as cross products: 2 multiplications per 
+ * entry of the result instead of 3.
+ * kronFactors[i] is the size of the left factor A when the matrix i is a KroneckerProduct A (x) B, {0, 0} otherwise: 
+ * its products are computed one factor at a time.
+ */
+template<
+	std::array dims, 
+	std::array<bool, dims.size()-1> skewFactors = std::array<bool, dims.size()-1>{}, 
+	std::array<std::array<size_t, 2>, dims.size()-1> kronFactors = std::array<std::array<size_t, 2>, dims.size()-1>{}> 
 struct MatrixProductChain
 {
+	// cost of multiplying the products of the factors [i, k) and [k, j)
+	static constexpr size_t mulCost(const size_t i, const size_t k, const size_t j);
+	
+	// cost of applying the Kronecker product of a m x n and a p x q matrix to a vector, with the cheapest factor first
+	static constexpr size_t kronApplyCost(const size_t m, const size_t n, const size_t p, const size_t q);
+	
 	template<size_t i, size_t j>
 	static constexpr std::pair<size_t, size_t> minMulCostAndSplitRec(BIC::Fixed<size_t, i> fixed_i, BIC::Fixed<size_t, j> fixed_j);
 	
@@ -3,11 +3,56 @@
 
 #include <FSLinalg/Matrix/MatrixProductChain.hpp>
 
+#include <algorithm>
+
 namespace FSLinalg
 {
 
-template<std::array dims> template<size_t I, size_t J>
-constexpr std::pair<size_t, size_t> MatrixProductChain<dims>::minMulCostAndSplitRec(BIC::Fixed<size_t, I> i, BIC::Fixed<size_t, J> j)
+template<std::array dims, std::array<bool, dims.size()-1> skewFactors, std::array<std::array<size_t, 2>, dims.size()-1> kronFactors>
+constexpr size_t MatrixProductChain<dims, skewFactors, kronFactors>::kronApplyCost(const size_t m, const size_t n, const size_t p, const size_t q)
+{
+	return std::min(m*n*q + m*q*p, n*q*p + m*n*p);
+}
+
+template<std::array dims, std::array<bool, dims.size()-1> skewFactors, std::array<std::array<size_t, 2>, dims.size()-1> kronFactors>
+constexpr size_t MatrixProductChain<dims, skewFactors, kronFactors>::mulCost(const size_t i, const size_t k, const size_t j)
+{
+	const bool isLhsSkew = (k == i + 1) and skewFactors[i];
+	const bool isRhsSkew = (j == k + 1) and skewFactors[k];
+	
+	if (isLhsSkew or isRhsSkew) { return 2*dims[i]*dims[j]; }
+	
+	const bool isLhsKron = (k == i + 1) and kronFactors[i][0] != 0;
+	const bool isRhsKron = (j == k + 1) and kronFactors[k][0] != 0;
+	
+	// the mixed-product identity needs the inner dimensions of both pairs of factors to match: the second factors then
+	// match as well, dims[k] being the product of the inner dimensions of each pair
+	const bool areKronAligned = isLhsKron and isRhsKron and kronFactors[i][1] == kronFactors[k][0];
+	
+	if (areKronAligned)
+	{
+		// (A1*A2) (x) (B1*B2), then expanded
+		const auto [m1, n1] = kronFactors[i];
+		const size_t n2 = kronFactors[k][1];
+		return m1*n1*n2 + (dims[i]/m1)*(dims[k]/n1)*(dims[j]/n2) + dims[i]*dims[j];
+	}
+	if (isLhsKron)
+	{
+		// a Kronecker rhs whose factors do not line up is expanded first
+		const auto [m, n] = kronFactors[i];
+		return dims[j]*kronApplyCost(m, n, dims[i]/m, dims[k]/n) + (isRhsKron ? dims[k]*dims[j] : 0);
+	}
+	if (isRhsKron)
+	{
+		const auto [m, n] = kronFactors[k];
+		return dims[i]*kronApplyCost(m, n, dims[k]/m, dims[j]/n);
+	}
+	
+	return dims[i]*dims[k]*dims[j];
+}
+
+template<std::array dims, std::array<bool, dims.size()-1> skewFactors, std::array<std::array<size_t, 2>, dims.size()-1> kronFactors> template<size_t I, size_t J>
+constexpr std::pair<size_t, size_t> MatrixProductChain<dims, skewFactors, kronFactors>::minMulCostAndSplitRec(BIC::Fixed<size_t, I> i, BIC::Fixed<size_t, J> j)
 {
 	if constexpr (i + 1 == j) 
 	{ 
@@ -20,7 +65,7 @@ constexpr std::pair<size_t, size_t> MatrixProductChain<dims>::minMulCostAndSplit
 		
 		BIC::foreach(BIC::next(i), j, [i, j, &minCost, &optSpliting](const auto k) -> void
 		{
-			constexpr size_t curr = minCostAndSplit<i, k>.first + minCostAndSplit<k, j>.first + dims[i]*dims[k]*dims[j];
+			constexpr size_t curr = minCostAndSplit<i, k>.first + minCostAndSplit<k, j>.first + mulCost(i, k, j);
 			if (curr < minCost)
 			{
 				minCost = curr;
@@ -14,6 +14,67 @@ constexpr bool MatrixProduct<Lhs,Rhs>::isOptimallyBracked()
 	return std::is_same<Self, OptimallyBracketedSelf>::value;
 }
 
+template<class Lhs, class Rhs> 
+template<bool incrDst, typename Beta, class Dst>
+void MatrixProduct<Lhs,Rhs>::runAliased(const Beta& beta, const StrippedLhs& A, const StrippedRhs& B, Dst& dst)
+{
+	using ScalarY = typename Dst::Scalar;
+	
+	[[maybe_unused]] const bool isLhsAliased = A.isAliasedTo(dst);
+	[[maybe_unused]] const bool isRhsAliased = B.isAliasedTo(dst);
+	
+	if constexpr (canBufferRows and IsDenseMatrix<Dst>::value)
+	{
+		if (not isRhsAliased)
+		{
+			using GemmRow = BasicLinalg::GeneralMatrixMatrixProduct<false, isLhsConjugated, 1, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, incrDst>;
+			
+			detail::recordAliasingStrategy(AliasingStrategy::RowBuffer);
+			
+			Matrix<typename StrippedLhs::Scalar, 1, LhsNCols> rowA(typename StrippedLhs::Scalar(0));
+			Matrix<ScalarY, 1, nCols> rowY(ScalarY(0));
+			for (Size i=0; i!=nRows; ++i)
+			{
+				for (Size k=0; k!=LhsNCols; ++k) { rowA[k] = A(i,k); }
+				if constexpr (incrDst) { for (Size j=0; j!=nCols; ++j) { rowY[j] = dst(i,j); } }
+				GemmRow::run(beta, rowA, B, rowY);
+				for (Size j=0; j!=nCols; ++j) { dst(i,j) = rowY[j]; }
+			}
+			return;
+		}
+	}
+	if constexpr (canBufferColumns and IsDenseMatrix<Dst>::value)
+	{
+		if (not isLhsAliased)
+		{
+			using GemmColumn = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, false, isRhsConjugated, RhsNRows, 1, incrDst>;
+			
+			detail::recordAliasingStrategy(AliasingStrategy::ColumnBuffer);
+			
+			Matrix<typename StrippedRhs::Scalar, RhsNRows, 1> colB(typename StrippedRhs::Scalar(0));
+			Matrix<ScalarY, nRows, 1> colY(ScalarY(0));
+			for (Size j=0; j!=nCols; ++j)
+			{
+				for (Size k=0; k!=RhsNRows; ++k) { colB[k] = B(k,j); }
+				if constexpr (incrDst) { for (Size i=0; i!=nRows; ++i) { colY[i] = dst(i,j); } }
+				GemmColumn::run(beta, A, colB, colY);
+				for (Size i=0; i!=nRows; ++i) { dst(i,j) = colY[i]; }
+			}
+			return;
+		}
+	}
+	
+	using GemmAssign = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, false>;
+	
+	detail::recordAliasingStrategy(AliasingStrategy::Temporary);
+	
+	// the kernel overwrites the temporary, dst is not copied into it
+	Matrix<ScalarY, Dst::nRows, Dst::nCols> tmp(ScalarY(0));
+	GemmAssign::run(beta, A, B, tmp);
+	if constexpr (incrDst) { for (Size i=0; i!=size; ++i) { dst[i] += tmp[i]; } }
+	else                   { for (Size i=0; i!=size; ++i) { dst[i]  = tmp[i]; } }
+}
+
 template<class Lhs, class Rhs> 
 template<typename Bool, typename Alpha, class Dst, bool keepBracketing>
 void MatrixProduct<Lhs,Rhs>::assignToHelper(const Bool checkAliasing, const Alpha& alpha, MatrixBase<Dst>& dst, BIC::Fixed<bool, keepBracketing>) const 
@@ -31,16 +92,16 @@ void MatrixProduct<Lhs,Rhs>::assignToHelper(const Bool checkAliasing, const Alph
 		const StrippedLhs& A = strippedLhs.getMatrix();
 		const StrippedRhs& B = strippedRhs.getMatrix();
 		
-		if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
-		{
-			Matrix<typename Dst::Scalar, Dst::nRows, Dst::nCols> tmp(dst);
-			GemmAssign::run(beta, A, B, tmp);
-			for (Size i=0; i!=size; ++i) { dst[i] = tmp[i]; }
-		}
-		else
+		if constexpr (StrippedLhs::template CanBeAlisaedTo<Dst>::value or StrippedRhs::template CanBeAlisaedTo<Dst>::value)
 		{
-			GemmAssign::run(beta, A, B, dst.derived());
+			if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
+			{
+				runAliased<false>(beta, A, B, dst.derived());
+				return;
+			}
 		}
+		
+		GemmAssign::run(beta, A, B, dst.derived());
 	}
 	else
 	{
@@ -55,7 +116,6 @@ void MatrixProduct<Lhs,Rhs>::incrementHelper(const Bool checkAliasing, const Alp
 {	
 	if constexpr (isOptimallyBracked() or keepBracketing)
 	{
-		using GemmAssign    = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, false>;
 		using GemmIncrement = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, true>;
 		
 		StripSymbolsAndEvalMatrix<Lhs> strippedLhs(m_lhs);
@@ -65,16 +125,16 @@ void MatrixProduct<Lhs,Rhs>::incrementHelper(const Bool checkAliasing, const Alp
 		const StrippedLhs& A = strippedLhs.getMatrix();
 		const StrippedRhs& B = strippedRhs.getMatrix();
 		
-		if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
-		{
-			Matrix<typename Dst::Scalar, Dst::nRows, Dst::nCols> tmp(dst);
-			GemmAssign::run(beta, A, B, tmp);
-			for (Size i=0; i!=size; ++i) { dst[i] += tmp[i]; }
-		}
-		else
+		if constexpr (StrippedLhs::template CanBeAlisaedTo<Dst>::value or StrippedRhs::template CanBeAlisaedTo<Dst>::value)
 		{
-			GemmIncrement::run(beta, A, B, dst.derived());
+			if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
+			{
+				runAliased<true>(beta, A, B, dst.derived());
+				return;
+			}
 		}
+		
+		GemmIncrement::run(beta, A, B, dst.derived());
 	}
 	else
 	{
@@ -89,7 +149,6 @@ void MatrixProduct<Lhs,Rhs>::decrementHelper(const Bool checkAliasing, const Alp
 {
 	if constexpr (isOptimallyBracked() or keepBracketing)
 	{
-		using GemmAssign    = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, false>;
 		using GemmIncrement = BasicLinalg::GeneralMatrixMatrixProduct<isLhsTransposed, isLhsConjugated, LhsNRows, LhsNCols, isRhsTransposed, isRhsConjugated, RhsNRows, RhsNCols, true>;
 		
 		StripSymbolsAndEvalMatrix<Lhs> strippedLhs(m_lhs);
@@ -99,16 +158,16 @@ void MatrixProduct<Lhs,Rhs>::decrementHelper(const Bool checkAliasing, const Alp
 		const StrippedLhs& A = strippedLhs.getMatrix();
 		const StrippedRhs& B = strippedRhs.getMatrix();
 		
-		if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
+		if constexpr (StrippedLhs::template CanBeAlisaedTo<Dst>::value or StrippedRhs::template CanBeAlisaedTo<Dst>::value)
 		{
-			Matrix<typename Dst::Scalar, Dst::nRows, Dst::nCols> tmp(dst);
-			GemmAssign::run(beta, A, B, tmp);
-			for (Size i=0; i!=size; ++i) { dst[i] -= tmp[i]; }
-		}
-		else
-		{
-			GemmIncrement::run(-beta, A, B, dst.derived());
+			if (checkAliasing and (A.isAliasedTo(dst) or B.isAliasedTo(dst)))
+			{
+				runAliased<true>(-beta, A, B, dst.derived());
+				return;
+			}
 		}
+		
+		GemmIncrement::run(-beta, A, B, dst.derived());
 	}
 	else
 	{
@@ -41,6 +41,8 @@ public:
 	
 	const_ReturnType getImpl(const Size i) const requires(hasReadRandomAccess and hasFlatRandomAccess) { return m_lhs.getImpl(i) + m_rhs.getImpl(i); }
 	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Lhs::template CanBeAlisaedTo<Dst>::value or Rhs::template CanBeAlisaedTo<Dst>::value> {};
+	
 	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& other) const { return m_lhs.isAliasedToImpl(other) or m_rhs.isAliasedToImpl(other); }
 
 	template<typename Bool, typename Alpha, class Dst>
@@ -59,6 +59,8 @@ public:
 	MatrixTransposed& operator*=(const Scalar& alpha);
 	MatrixTransposed& operator/=(const Scalar& alpha);
 
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Expr::template CanBeAlisaedTo<Dst>::value> {};
+	
 	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
 
 	template<typename Bool, typename Alpha, class Dst>
@@ -79,6 +81,8 @@ MatrixTransposed<Expr> transpose(const MatrixBase<Expr>& expr) { return MatrixTr
 template<class Expr> 
 MatrixConj< MatrixTransposed<Expr> > adjoint(const MatrixBase<Expr>& expr) { return MatrixConj< MatrixTransposed<Expr> >(MatrixTransposed<Expr>(expr)); }
 
+template<class Expr> struct IsLeafTransposition< MatrixTransposed<Expr> > : BIC::Fixed<bool, Expr::isLeaf> {};
+
 } // namespace FSLinalg
 
 #endif // FSLINALG_MATRIX_TRANSPOSE_HPP
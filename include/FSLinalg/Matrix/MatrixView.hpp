@@ -0,0 +1,63 @@
+#ifndef FSLINALG_MATRIX_VIEW_HPP
+#define FSLINALG_MATRIX_VIEW_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
+
+#include <type_traits>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int Nrows, unsigned int Ncols> class MatrixView;
+
+template<typename T, unsigned int Nrows, unsigned int Ncols>
+struct MatrixTraits< MatrixView<T, Nrows, Ncols> >
+{	
+	using Scalar = T;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false; // a pointer, which expressions can safely hold by value
+	
+	static constexpr Size nRows = Nrows;
+	static constexpr Size nCols = Ncols;
+};
+
+/*
+ * Read-only view over Nrows*Ncols row-major scalars owned elsewhere (e.g. a memory mapped file, see IO/BinaryReader.hpp).
+ * Products evaluate the view into a Matrix, like any other non-leaf operand.
+ */
+template<typename T, unsigned int Nrows, unsigned int Ncols>
+class MatrixView : public MatrixBase< MatrixView<T, Nrows, Ncols> >
+{
+public:
+	using Self = MatrixView<T, Nrows, Ncols>;
+	FSLINALG_DEFINE_MATRIX
+	
+	explicit MatrixView(const T* data) : m_data(data) {}
+	
+	const T* data() const { return m_data; }
+	
+	const_ReturnType getImpl(const Size i)               const { return m_data[i]; }
+	const_ReturnType getImpl(const Size i, const Size j) const { return m_data[i*nCols + j]; }
+	
+	// the viewed scalars may be the storage of a dense destination (e.g. MatrixView(M.data())), compared by storage
+	template<class Dst>
+	struct CanBeAlisaedTo : BIC::Fixed<bool,
+		    IsDenseMatrix<Dst>::value
+		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
+	
+	template<class Dst>           bool isAliasedToImpl(const MatrixBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
+private:
+	const T* m_data;
+};
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_MATRIX_VIEW_HPP
@@ -2,9 +2,9 @@
 #define FSLINALG_MATRIX_IMPL_HPP
 
 #include <FSLinalg/Matrix/Matrix.hpp>
+#include <FSLinalg/Tensor/TensorMap.hpp>
 
 #include <cassert>
-#include <random>
 
 namespace FSLinalg
 {
@@ -42,16 +42,10 @@ Matrix<T,Nrows,Ncols>::Matrix(std::initializer_list< std::initializer_list<Scala
 }
 
 template<typename T, unsigned int Nrows, unsigned Ncols>
-auto Matrix<T,Nrows,Ncols>::random(const RealScalar& lb, const RealScalar& ub) -> Matrix
+auto Matrix<T,Nrows,Ncols>::random(RandomEngine& engine, const RealScalar& lb, const RealScalar& ub) -> Matrix
 {
-	std::random_device rd; 
-	std::mt19937 gen(rd()); 
-	std::uniform_real_distribution<RealScalar> dist(lb, ub);
-	
-	Matrix ret;
-	
-	for (Size i=0; i!=size; ++i) { ret[i] = dist(gen); }
-	
+	Matrix ret(RealScalar(0));
+	engine.fillUniform(std::span<Scalar>(ret.m_data), lb, ub);
 	return ret;
 }
 
@@ -0,0 +1,33 @@
+#ifndef FSLINALG_NO_ALIAS_HPP
+#define FSLINALG_NO_ALIAS_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+
+namespace FSLinalg
+{
+
+/*
+ * Destination of dst.noalias() = expr: the caller guarantees that expr does not read dst, so the assignment skips
+ * the aliasing checks and their fallback code and goes straight to the kernels. Wrong results if expr does read dst.
+ */
+template<class Dst>
+class NoAlias
+{
+public:
+	using Scalar     = typename Dst::Scalar;
+	using RealScalar = typename Dst::RealScalar;
+	
+	template<class Src> using IsConstructibleFrom = typename Dst::template IsConstructibleFrom<Src>;
+	
+	explicit NoAlias(MatrixBase<Dst>& dst) : m_dst(dst.derived()) {}
+	
+	template<class Expr> Dst& operator= (const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.assignTo (BIC::fixed<bool, false>, BIC::fixed<RealScalar, RealScalar(1)>, m_dst); return m_dst; }
+	template<class Expr> Dst& operator+=(const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.increment(BIC::fixed<bool, false>, BIC::fixed<RealScalar, RealScalar(1)>, m_dst); return m_dst; }
+	template<class Expr> Dst& operator-=(const MatrixBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.decrement(BIC::fixed<bool, false>, BIC::fixed<RealScalar, RealScalar(1)>, m_dst); return m_dst; }
+private:
+	Dst& m_dst;
+};
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_NO_ALIAS_HPP
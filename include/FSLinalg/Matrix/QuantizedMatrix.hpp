@@ -0,0 +1,110 @@
+#ifndef FSLINALG_QUANTIZED_MATRIX_HPP
+#define FSLINALG_QUANTIZED_MATRIX_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+#include <array>
+#include <cstdint>
+
+namespace FSLinalg
+{
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols> class QuantizedMatrix;
+template<class Lhs, class Rhs>                                 class MatrixProduct;
+
+// Affine quantization: value = scale*(q - zeroPoint)
+struct Quantization
+{
+	float        scale     = 1.f;
+	std::int32_t zeroPoint = 0;
+};
+
+// Integer types used by the integer GEMM: operands once the zero point is removed, and accumulator
+template<typename Int> struct QuantizedTraits;
+
+template<> struct QuantizedTraits<std::int8_t>  { using Operand = std::int16_t; using Accumulator = std::int32_t; };
+template<> struct QuantizedTraits<std::int16_t> { using Operand = std::int32_t; using Accumulator = std::int64_t; };
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols>
+struct MatrixTraits< QuantizedMatrix<Int, Nrows, Ncols> >
+{
+	using Scalar = float;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = true;
+	
+	static constexpr Size nRows = Nrows;
+	static constexpr Size nCols = Ncols;
+};
+
+/*
+ * Matrix stored as Int (int8_t or int16_t) with a single scale/zero point. Elements read back dequantized as float.
+ * Products between quantized matrices run on the integers with a wide integer accumulator, and a quantized matrix built 
+ * from such a product is requantized directly from the accumulators.
+ */
+template<typename Int, unsigned int Nrows, unsigned int Ncols>
+class QuantizedMatrix : public MatrixBase< QuantizedMatrix<Int, Nrows, Ncols> >
+{
+public:
+	using Self = QuantizedMatrix<Int, Nrows, Ncols>;
+	FSLINALG_DEFINE_MATRIX
+	
+	using Storage = Int;
+	
+	template<class Src> 
+	struct IsQuantizable : BIC::Fixed<bool, 
+		    IsMatrix<Src>::value
+		and Src::nRows == Nrows
+		and Src::nCols == Ncols
+		and IsRealScalar<typename Src::Scalar>::value> {};
+	
+	QuantizedMatrix(const Quantization& quantization = {}) : m_quantization(quantization) { m_data.fill(quantize(0.f, quantization)); }
+	
+	QuantizedMatrix(const QuantizedMatrix& other) : m_quantization(other.m_quantization), m_data(other.m_data) {}
+	
+	template<class Expr> QuantizedMatrix(const MatrixBase<Expr>& expr, const Quantization& quantization) requires(IsQuantizable<Expr>::value);
+	
+	QuantizedMatrix& operator=(const QuantizedMatrix& other) { m_quantization = other.m_quantization; m_data = other.m_data; return *this; }
+	
+	// requantizes expr with the current quantization
+	template<class Expr> QuantizedMatrix& operator=(const MatrixBase<Expr>& expr) requires(IsQuantizable<Expr>::value) { return *this = QuantizedMatrix(expr, m_quantization); }
+	
+	const_ReturnType getImpl(const Size i)               const { return dequantize(m_data[i]);         }
+	const_ReturnType getImpl(const Size i, const Size j) const { return dequantize(m_data[i*nCols + j]); }
+	
+	Int  getQuantized(const Size i) const { return m_data[i]; }
+	Int& getQuantized(const Size i)       { return m_data[i]; }
+	
+	const Quantization& getQuantization() const { return m_quantization; }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
+	
+	// quantization mapping [lb, ub] onto the whole range of Int
+	static Quantization fitRange(const float lb, const float ub);
+	
+	static Int quantize(const float value, const Quantization& quantization);
+private:
+	float dequantize(const Int q) const { return m_quantization.scale*static_cast<float>(std::int32_t(q) - m_quantization.zeroPoint); }
+	
+	template<class Lhs, class Rhs> void assignProduct(const MatrixProduct<Lhs,Rhs>& prod);
+	
+	Quantization                 m_quantization;
+	std::array<Int, Nrows*Ncols> m_data;
+};
+
+template<typename Expr>                                        struct IsQuantizedMatrix                                       : BIC::Fixed<bool, false> {};
+template<typename Int, unsigned int Nrows, unsigned int Ncols> struct IsQuantizedMatrix< QuantizedMatrix<Int, Nrows, Ncols> > : BIC::Fixed<bool, true>  {};
+
+template<unsigned int Nrows, unsigned Ncols> using Int8Matrix  = QuantizedMatrix<std::int8_t,  Nrows, Ncols>;
+template<unsigned int Nrows, unsigned Ncols> using Int16Matrix = QuantizedMatrix<std::int16_t, Nrows, Ncols>;
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_QUANTIZED_MATRIX_HPP
@@ -0,0 +1,88 @@
+#ifndef FSLINALG_QUANTIZED_MATRIX_IMPL_HPP
+#define FSLINALG_QUANTIZED_MATRIX_IMPL_HPP
+
+#include <FSLinalg/Matrix/QuantizedMatrix.hpp>
+#include <FSLinalg/Matrix/MatrixProduct.hpp>
+#include <FSLinalg/Matrix/StripSymbolsAndEvalMatrix.hpp>
+#include <FSLinalg/BasicLinalg/GeneralMatrixMatrixProduct.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+template<typename Expr> struct IsQuantizedProduct : BIC::Fixed<bool, false> {};
+
+template<class Lhs, class Rhs> 
+struct IsQuantizedProduct< MatrixProduct<Lhs,Rhs> > : BIC::Fixed<bool, 
+	    IsQuantizedMatrix<typename StripSymbolsAndEvalMatrix<Lhs>::Matrix>::value 
+	and IsQuantizedMatrix<typename StripSymbolsAndEvalMatrix<Rhs>::Matrix>::value> {};
+
+} // namespace detail
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols> template<class Expr>
+QuantizedMatrix<Int,Nrows,Ncols>::QuantizedMatrix(const MatrixBase<Expr>& base_expr, const Quantization& quantization) requires(IsQuantizable<Expr>::value) :
+	m_quantization(quantization)
+{
+	if constexpr (detail::IsQuantizedProduct<Expr>::value)
+	{
+		assignProduct(base_expr.derived());
+	}
+	else
+	{
+		using Tmp = std::conditional_t<Expr::hasReadRandomAccess and Expr::hasFlatRandomAccess, const Expr&, Matrix<typename Expr::Scalar, Nrows, Ncols> >;
+		
+		Tmp expr(base_expr.derived());
+		for (Size i=0; i!=size; ++i) { m_data[i] = quantize(static_cast<float>(expr[i]), m_quantization); }
+	}
+}
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols>
+Quantization QuantizedMatrix<Int,Nrows,Ncols>::fitRange(const float lb, const float ub)
+{
+	constexpr float qmin = float(std::numeric_limits<Int>::min());
+	constexpr float qmax = float(std::numeric_limits<Int>::max());
+	
+	// the range must contain 0 so that it is exactly representable
+	const float lo = std::min(lb, 0.f);
+	const float hi = std::max(ub, 0.f);
+	
+	Quantization ret;
+	ret.scale     = (hi > lo) ? (hi - lo)/(qmax - qmin) : 1.f;
+	ret.zeroPoint = static_cast<std::int32_t>(std::lround(qmin - lo/ret.scale));
+	return ret;
+}
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols>
+Int QuantizedMatrix<Int,Nrows,Ncols>::quantize(const float value, const Quantization& quantization)
+{
+	constexpr long qmin = long(std::numeric_limits<Int>::min());
+	constexpr long qmax = long(std::numeric_limits<Int>::max());
+	
+	const long q = std::lround(value/quantization.scale) + long(quantization.zeroPoint);
+	return static_cast<Int>(std::clamp(q, qmin, qmax));
+}
+
+template<typename Int, unsigned int Nrows, unsigned int Ncols> template<class Lhs, class Rhs>
+void QuantizedMatrix<Int,Nrows,Ncols>::assignProduct(const MatrixProduct<Lhs,Rhs>& prod)
+{
+	using StripLhs = StripSymbolsAndEvalMatrix<Lhs>;
+	using StripRhs = StripSymbolsAndEvalMatrix<Rhs>;
+	using Gemm     = BasicLinalg::GeneralMatrixMatrixProduct<StripLhs::isTransposed, StripLhs::isConjugated, StripLhs::nRows, StripLhs::nCols, StripRhs::isTransposed, StripRhs::isConjugated, StripRhs::nRows, StripRhs::nCols, false>;
+	
+	StripLhs strippedLhs(prod.m_lhs);
+	StripRhs strippedRhs(prod.m_rhs);
+	
+	const auto beta = strippedLhs.getAlpha()*strippedRhs.getAlpha();
+	
+	Gemm::run(beta, strippedLhs.getMatrix(), strippedRhs.getMatrix(), *this);
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_QUANTIZED_MATRIX_IMPL_HPP
@@ -0,0 +1,72 @@
+#ifndef FSLINALG_SKEW_MATRIX_HPP
+#define FSLINALG_SKEW_MATRIX_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+namespace FSLinalg
+{
+	
+template<typename T> class SkewMatrix;
+
+template<typename T>
+struct MatrixTraits< SkewMatrix<T> >
+{	
+	using Scalar = T;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = false;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false; // a by-value copy of 3 scalars, which expressions can safely hold
+	
+	static constexpr Size nRows = 3;
+	static constexpr Size nCols = 3;
+};
+
+/*
+ * The cross product matrix [a]x of a 3D vector, [a]x * b = a x b. Only a is stored: products with a SkewMatrix 
+ * operand are computed as cross products and never expand the 3x3 matrix (see StripSymbolsAndEvalMatrix).
+ */
+template<typename T> 
+class SkewMatrix : public MatrixBase< SkewMatrix<T> >
+{
+public:
+	using Self = SkewMatrix<T>;
+	FSLINALG_DEFINE_MATRIX
+	
+	template<class Expr> 
+	explicit SkewMatrix(const MatrixBase<Expr>& a) requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector)) : m_vector(Scalar(0))
+	{
+		const Matrix<typename Expr::Scalar, Expr::nRows, Expr::nCols> tmp(a.derived());
+		for (Size i=0; i!=3; ++i) { m_vector[i] = static_cast<Scalar>(tmp[i]); }
+	}
+	
+	const_ReturnType getImpl(const Size i, const Size j) const 
+	{
+		if (i == j) { return Scalar(0); }
+		
+		// (i,j) = -e_ijk a_k
+		const Size k = 3 - i - j;
+		return ((j == (i + 1) % 3) ? -m_vector[k] : m_vector[k]);
+	}
+	
+	const RowVector<Scalar, 3>& vector() const { return m_vector; }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
+private:
+	RowVector<Scalar, 3> m_vector;
+};
+
+template<typename Expr> struct IsSkewMatrix                  : BIC::Fixed<bool, false> {};
+template<typename T>    struct IsSkewMatrix< SkewMatrix<T> > : BIC::Fixed<bool, true>  {};
+
+template<class Expr> requires(Expr::size == 3 and (Expr::isRowVector or Expr::isColVector))
+SkewMatrix<typename Expr::Scalar> skew(const MatrixBase<Expr>& a) { return SkewMatrix<typename Expr::Scalar>(a); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_SKEW_MATRIX_HPP
@@ -0,0 +1,91 @@
+#ifndef FSLINALG_SPLIT_COMPLEX_MATRIX_HPP
+#define FSLINALG_SPLIT_COMPLEX_MATRIX_HPP
+
+#include <FSLinalg/Matrix/MatrixBase.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int Nrows, unsigned int Ncols> class SplitComplexMatrix;
+template<class Lhs, class Rhs>                              class MatrixProduct;
+
+template<typename T, unsigned int Nrows, unsigned int Ncols>
+struct MatrixTraits< SplitComplexMatrix<T, Nrows, Ncols> >
+{
+	static_assert(RealScalar_concept<T>, "The planes of a split complex matrix must be real");
+	
+	using Scalar = std::complex<T>;
+	using Size   = unsigned int;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = true;
+	
+	static constexpr Size nRows = Nrows;
+	static constexpr Size nCols = Ncols;
+};
+
+/*
+ * Complex matrix stored as two real planes instead of interleaved std::complex values.
+ * Products between split matrices are computed as real products on the planes and conjugation is only a sign change
+ * of the imaginary plane. Elements can be read but not written, the planes are exposed through getReal() and getImag().
+ */
+template<typename T, unsigned int Nrows, unsigned int Ncols>
+class SplitComplexMatrix : public MatrixBase< SplitComplexMatrix<T, Nrows, Ncols> >
+{
+public:
+	using Self = SplitComplexMatrix<T, Nrows, Ncols>;
+	FSLINALG_DEFINE_MATRIX
+	
+	using Plane = Matrix<T, Nrows, Ncols>;
+	
+	template<class Src> 
+	struct IsSplittable : BIC::Fixed<bool, 
+		    IsMatrix<Src>::value
+		and Src::nRows == Nrows
+		and Src::nCols == Ncols
+		and std::is_convertible<typename Src::Scalar, Scalar>::value> {};
+	
+	SplitComplexMatrix(const Scalar& value = Scalar(0)) : m_real(value.real()), m_imag(value.imag()) {}
+	SplitComplexMatrix(std::initializer_list< std::initializer_list<Scalar> > values) : SplitComplexMatrix(Matrix<Scalar, Nrows, Ncols>(values)) {}
+	SplitComplexMatrix(const Plane& re, const Plane& im) : m_real(re), m_imag(im) {}
+	
+	SplitComplexMatrix(const SplitComplexMatrix& other) : m_real(other.m_real), m_imag(other.m_imag) {}
+	
+	template<class Expr> SplitComplexMatrix(const MatrixBase<Expr>& expr) requires(IsSplittable<Expr>::value);
+	
+	SplitComplexMatrix& operator=(const SplitComplexMatrix& other) { m_real = other.m_real; m_imag = other.m_imag; return *this; }
+	
+	template<class Expr> SplitComplexMatrix& operator=(const MatrixBase<Expr>& expr) requires(IsSplittable<Expr>::value) { return *this = SplitComplexMatrix(expr); }
+	
+	const_ReturnType getImpl(const Size i)               const { return Scalar(m_real[i],   m_imag[i]);   }
+	const_ReturnType getImpl(const Size i, const Size j) const { return Scalar(m_real(i,j), m_imag(i,j)); }
+	
+	const Plane& getReal() const { return m_real; }
+	      Plane& getReal()       { return m_real; }
+	const Plane& getImag() const { return m_imag; }
+	      Plane& getImag()       { return m_imag; }
+	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
+	
+	static SplitComplexMatrix random(const T& lb = T(-1), const T& ub = T(1)) { return SplitComplexMatrix(Plane::random(lb, ub), Plane::random(lb, ub)); }
+private:
+	template<class Lhs, class Rhs> void assignProduct(const MatrixProduct<Lhs,Rhs>& prod);
+	
+	Plane m_real;
+	Plane m_imag;
+};
+
+template<typename Expr>                                      struct IsSplitComplexMatrix                                          : BIC::Fixed<bool, false> {};
+template<typename T, unsigned int Nrows, unsigned int Ncols> struct IsSplitComplexMatrix< SplitComplexMatrix<T, Nrows, Ncols> > : BIC::Fixed<bool, true>  {};
+
+template<unsigned int Nrows, unsigned Ncols> using SplitCpxMatrix = SplitComplexMatrix<double, Nrows, Ncols>;
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_SPLIT_COMPLEX_MATRIX_HPP
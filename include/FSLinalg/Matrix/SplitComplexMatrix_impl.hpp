@@ -0,0 +1,60 @@
+#ifndef FSLINALG_SPLIT_COMPLEX_MATRIX_IMPL_HPP
+#define FSLINALG_SPLIT_COMPLEX_MATRIX_IMPL_HPP
+
+#include <FSLinalg/Matrix/SplitComplexMatrix.hpp>
+#include <FSLinalg/Matrix/MatrixProduct.hpp>
+#include <FSLinalg/Matrix/StripSymbolsAndEvalMatrix.hpp>
+#include <FSLinalg/BasicLinalg/GeneralMatrixMatrixProduct.hpp>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+template<typename Expr> struct IsSplitComplexProduct : BIC::Fixed<bool, false> {};
+
+template<class Lhs, class Rhs> 
+struct IsSplitComplexProduct< MatrixProduct<Lhs,Rhs> > : BIC::Fixed<bool, 
+	    IsSplitComplexMatrix<typename StripSymbolsAndEvalMatrix<Lhs>::Matrix>::value 
+	and IsSplitComplexMatrix<typename StripSymbolsAndEvalMatrix<Rhs>::Matrix>::value> {};
+
+} // namespace detail
+
+template<typename T, unsigned int Nrows, unsigned int Ncols> template<class Expr>
+SplitComplexMatrix<T,Nrows,Ncols>::SplitComplexMatrix(const MatrixBase<Expr>& base_expr) requires(IsSplittable<Expr>::value)
+{
+	if constexpr (detail::IsSplitComplexProduct<Expr>::value)
+	{
+		assignProduct(base_expr.derived());
+	}
+	else if constexpr (Expr::hasReadRandomAccess and Expr::hasFlatRandomAccess)
+	{
+		const Expr& expr = base_expr.derived();
+		for (Size i=0; i!=size; ++i) { const Scalar z = expr[i]; m_real[i] = z.real(); m_imag[i] = z.imag(); }
+	}
+	else
+	{
+		const Matrix<Scalar, Nrows, Ncols> tmp(base_expr.derived());
+		for (Size i=0; i!=size; ++i) { m_real[i] = tmp[i].real(); m_imag[i] = tmp[i].imag(); }
+	}
+}
+
+template<typename T, unsigned int Nrows, unsigned int Ncols> template<class Lhs, class Rhs>
+void SplitComplexMatrix<T,Nrows,Ncols>::assignProduct(const MatrixProduct<Lhs,Rhs>& prod)
+{
+	using StripLhs = StripSymbolsAndEvalMatrix<Lhs>;
+	using StripRhs = StripSymbolsAndEvalMatrix<Rhs>;
+	using Gemm     = BasicLinalg::GeneralMatrixMatrixProduct<StripLhs::isTransposed, StripLhs::isConjugated, StripLhs::nRows, StripLhs::nCols, StripRhs::isTransposed, StripRhs::isConjugated, StripRhs::nRows, StripRhs::nCols, false>;
+	
+	StripLhs strippedLhs(prod.m_lhs);
+	StripRhs strippedRhs(prod.m_rhs);
+	
+	const auto beta = strippedLhs.getAlpha()*strippedRhs.getAlpha();
+	
+	Gemm::run(beta, strippedLhs.getMatrix(), strippedRhs.getMatrix(), *this);
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_SPLIT_COMPLEX_MATRIX_IMPL_HPP
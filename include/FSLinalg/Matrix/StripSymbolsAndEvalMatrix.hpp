@@ -7,6 +7,9 @@
 #include <FSLinalg/Matrix/MatrixMinus.hpp>
 #include <FSLinalg/Matrix/MatrixConj.hpp>
 #include <FSLinalg/Matrix/MatrixTransposed.hpp>
+#include <FSLinalg/Matrix/MatrixCast.hpp>
+#include <FSLinalg/Matrix/SkewMatrix.hpp>
+#include <FSLinalg/Matrix/KroneckerProduct.hpp>
 
 namespace FSLinalg
 {
@@ -134,6 +137,91 @@ private:
 	StripSymbolsAndEvalMatrix<Expr> m_expr;
 };
 
+// skew matrices are forwarded as is, the products kernels computing cross products
+template<typename T>
+class StripSymbolsAndEvalMatrix< SkewMatrix<T> >
+{
+public:
+	using Matrix = SkewMatrix<T>;
+	using Scalar = BIC::Fixed<typename NumTraits<T>::Real, typename NumTraits<T>::Real(1)>;
+	
+	static constexpr bool isConjugated = false;
+	static constexpr bool isTransposed = false;
+	
+	static constexpr unsigned int nRows = 3;
+	static constexpr unsigned int nCols = 3;
+	
+	static constexpr bool createsTemporary = false;
+	
+	StripSymbolsAndEvalMatrix(const SkewMatrix<T>& skew_expr) : m_matrix(skew_expr) {}
+	
+	const     Matrix& getMatrix() const { return m_matrix; }
+	constexpr Scalar  getAlpha()  const { return {}; }
+private:
+	const SkewMatrix<T>& m_matrix;
+};
+
+// Kronecker products are forwarded as is, the products kernels applying the factors one at a time
+template<class FactorA, class FactorB>
+class StripSymbolsAndEvalMatrix< KroneckerProduct<FactorA, FactorB> >
+{
+public:
+	using Matrix = KroneckerProduct<FactorA, FactorB>;
+	using Scalar = BIC::Fixed<typename Matrix::RealScalar, typename Matrix::RealScalar(1)>;
+	
+	static constexpr bool isConjugated = false;
+	static constexpr bool isTransposed = false;
+	
+	static constexpr unsigned int nRows = Matrix::nRows;
+	static constexpr unsigned int nCols = Matrix::nCols;
+	
+	static constexpr bool createsTemporary = false;
+	
+	StripSymbolsAndEvalMatrix(const Matrix& kron_expr) : m_matrix(kron_expr) {}
+	
+	const     Matrix& getMatrix() const { return m_matrix; }
+	constexpr Scalar  getAlpha()  const { return {}; }
+private:
+	const Matrix& m_matrix;
+};
+
+/*
+ * A widening cast of a leaf is stripped: the leaf is used as is and the alpha carries the wider type, 
+ * so that the product is computed in U without converting the leaf.
+ */
+template<Scalar_concept U, class Expr>
+class StripSymbolsAndEvalMatrix< MatrixCast<U,Expr> >
+{
+public:
+	static constexpr bool isStripped = Expr::isLeaf and MatrixCast<U,Expr>::isWidening;
+	
+	using RealScalar = typename NumTraits<U>::Real;
+	using TmpMatrix  = FSLinalg::Matrix< U, Expr::nRows, Expr::nCols >;
+	using Matrix     = std::conditional_t<isStripped, Expr, TmpMatrix>;
+	using Scalar     = BIC::Fixed<RealScalar, RealScalar(1)>;
+	
+	static constexpr bool isConjugated = false;
+	static constexpr bool isTransposed = false;
+	
+	static constexpr unsigned int nRows = Expr::nRows;
+	static constexpr unsigned int nCols = Expr::nCols;
+	
+	static constexpr bool createsTemporary = not isStripped;
+	
+	StripSymbolsAndEvalMatrix(const MatrixCast<U,Expr>& cast_expr) : m_matrix(getSource(cast_expr)) {}
+	
+	const     Matrix& getMatrix() const { return m_matrix; }
+	constexpr Scalar  getAlpha()  const { return {}; }
+private:
+	static const auto& getSource(const MatrixCast<U,Expr>& cast_expr) 
+	{ 
+		if constexpr (isStripped) { return cast_expr.m_expr; }
+		else                      { return cast_expr;        }
+	}
+	
+	std::conditional_t<isStripped, const Expr&, TmpMatrix> m_matrix;
+};
+
 } // namespace FSLinalg
 
 #endif // FSLINALG_STRIP_SYMBOLS_AND_EVAL_MATRIX_HPP
@@ -44,6 +44,8 @@ public:
 	
 	Id getId() const { return m_id; }
 	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, false> {};
+	
 	template<class Dst> constexpr bool isAliasedToImpl(const MatrixBase<Dst>&) const { return false; }
 	template<class Dst>           bool isAliasedToImpl(const Self& dst)        const { return std::addressof(dst) == this; }
 private:
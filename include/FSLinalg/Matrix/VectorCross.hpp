@@ -37,6 +37,8 @@ public:
 	
 	VectorCross(const MatrixBase<Lhs>& lhs, const MatrixBase<Rhs>& rhs) : m_lhs(lhs.derived()), m_rhs(rhs.derived()) {}
 	
+	template<class Dst> struct CanBeAlisaedTo : BIC::Fixed<bool, Lhs::template CanBeAlisaedTo<Dst>::value or Rhs::template CanBeAlisaedTo<Dst>::value> {};
+	
 	template<class Dst> bool isAliasedToImpl(const MatrixBase<Dst>& dst) const { return m_lhs.isAliasedToImpl(dst) or m_rhs.isAliasedToImpl(dst); }
 	
 	template<typename Bool, typename Alpha, class Dst>
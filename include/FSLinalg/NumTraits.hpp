@@ -5,6 +5,7 @@
 #include <concepts>
 
 #include <cstdint>
+#include <type_traits>
 
 namespace FSLinalg
 {
@@ -75,6 +76,25 @@ struct NumTraits<bool>
 	static constexpr Real infinity  = std::numeric_limits<bool>::infinity();
 };
 
+//// accumulation policy
+
+/*
+ * Type in which sums of T are accumulated (GEMM, inner products, norms). Specialize it to change the accumulator globally,
+ * e.g. template<> struct FSLinalg::AccumulatorTraits<float> { using Type = double; };
+ */
+template<typename T>
+struct AccumulatorTraits
+{
+	using Type = T;
+};
+
+// Acc when given, AccumulatorTraits<T>::Type otherwise
+template<typename Acc, typename T> using AccumulatorType = std::conditional_t<std::is_void_v<Acc>, typename AccumulatorTraits<T>::Type, Acc>;
+
+// T promoted to at least the precision of the real type Real, keeping T complex if it is
+template<typename T, typename Real> struct PromoteTraits                         { using Type = std::common_type_t<T, Real>;                };
+template<typename T, typename Real> struct PromoteTraits< std::complex<T>, Real > { using Type = std::complex< std::common_type_t<T, Real> >; };
+
 } // namespace FSLinalg
 
 #endif // FSLINALG_NUM_TRAITS_HPP
@@ -0,0 +1,161 @@
+#ifndef FSLINALG_PACK_HPP
+#define FSLINALG_PACK_HPP
+
+#include <FSLinalg/Scalar.hpp>
+#include <FSLinalg/Matrix.hpp>
+
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <fmt/core.h>
+
+namespace FSLinalg
+{
+
+// result of comparing two packs, one bool per lane
+template<unsigned int W>
+struct PackMask
+{
+	using Size = unsigned int;
+	
+	std::array<bool, W> lanes;
+	
+	constexpr PackMask()             : lanes{} {}
+	constexpr PackMask(const bool b) : lanes{} { lanes.fill(b); }
+	
+	constexpr bool operator[](const Size k) const { return lanes[k]; }
+	
+	friend constexpr bool operator==(const PackMask& a, const PackMask& b) = default;
+	
+	friend constexpr PackMask operator&(const PackMask& a, const PackMask& b) { PackMask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] and b.lanes[k]; } return ret; }
+	friend constexpr PackMask operator|(const PackMask& a, const PackMask& b) { PackMask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] or  b.lanes[k]; } return ret; }
+	friend constexpr PackMask operator~(const PackMask& a)                    { PackMask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = not a.lanes[k];             } return ret; }
+	
+	friend constexpr bool all (const PackMask& a) { bool ret = true;  for (Size k=0; k!=W; ++k) { ret = ret and a.lanes[k]; } return ret; }
+	friend constexpr bool any (const PackMask& a) { bool ret = false; for (Size k=0; k!=W; ++k) { ret = ret or  a.lanes[k]; } return ret; }
+	friend constexpr bool none(const PackMask& a) { return not any(a); }
+};
+
+/*
+ * Fixed width SIMD pack used as a scalar: W independent values of type T, every operation acting lane-wise.
+ * A Matrix<Pack<T,W>,R,C> holds W matrices in structure-of-arrays layout, and every kernel written for real scalars
+ * (products, multiply-adds, reductions) processes the W matrices at once with loops over W that the compiler vectorizes.
+ * Comparisons return a PackMask; all() and any() reduce it, which is what the matrix and tensor operator== use.
+ * The type is structural so that it can be used as a template argument (BIC::Fixed).
+ */
+template<typename T, unsigned int W>
+struct Pack
+{
+	static_assert(std::is_arithmetic_v<T> and std::has_single_bit(W), "Packs hold a power of two number of arithmetic values");
+	
+	using Size  = unsigned int;
+	using Value = T;
+	using Mask  = PackMask<W>;
+	
+	static constexpr Size width = W;
+	
+	alignas(sizeof(T)*W) std::array<T, W> lanes;
+	
+	constexpr Pack()              : lanes{} {}
+	constexpr Pack(const T value) : lanes{} { lanes.fill(value); }
+	
+	static constexpr Pack load(const T* src)  { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = src[k]; } return ret; }
+	constexpr void        store(T* dst) const { for (Size k=0; k!=W; ++k) { dst[k] = lanes[k]; } }
+	
+	constexpr const T& operator[](const Size k) const { return lanes[k]; }
+	constexpr       T& operator[](const Size k)       { return lanes[k]; }
+	
+	friend constexpr Pack operator-(const Pack& a) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = -a.lanes[k]; } return ret; }
+	
+	friend constexpr Pack operator+(const Pack& a, const Pack& b) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] + b.lanes[k]; } return ret; }
+	friend constexpr Pack operator-(const Pack& a, const Pack& b) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] - b.lanes[k]; } return ret; }
+	friend constexpr Pack operator*(const Pack& a, const Pack& b) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] * b.lanes[k]; } return ret; }
+	friend constexpr Pack operator/(const Pack& a, const Pack& b) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] / b.lanes[k]; } return ret; }
+	
+	constexpr Pack& operator+=(const Pack& other) { return *this = *this + other; }
+	constexpr Pack& operator-=(const Pack& other) { return *this = *this - other; }
+	constexpr Pack& operator*=(const Pack& other) { return *this = *this * other; }
+	constexpr Pack& operator/=(const Pack& other) { return *this = *this / other; }
+	
+	friend constexpr Mask operator==(const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] == b.lanes[k]; } return ret; }
+	friend constexpr Mask operator!=(const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] != b.lanes[k]; } return ret; }
+	friend constexpr Mask operator< (const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] <  b.lanes[k]; } return ret; }
+	friend constexpr Mask operator> (const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] >  b.lanes[k]; } return ret; }
+	friend constexpr Mask operator<=(const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] <= b.lanes[k]; } return ret; }
+	friend constexpr Mask operator>=(const Pack& a, const Pack& b) { Mask ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = a.lanes[k] >= b.lanes[k]; } return ret; }
+	
+	// lanes of a where mask is set, lanes of b elsewhere
+	friend constexpr Pack select(const Mask& mask, const Pack& a, const Pack& b) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = mask.lanes[k] ? a.lanes[k] : b.lanes[k]; } return ret; }
+	
+	friend constexpr Pack min(const Pack& a, const Pack& b) { return select(b < a, b, a); }
+	friend constexpr Pack max(const Pack& a, const Pack& b) { return select(a < b, b, a); }
+	
+	friend Pack abs (const Pack& a) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = std::abs (a.lanes[k]); } return ret; }
+	friend Pack sqrt(const Pack& a) { Pack ret; for (Size k=0; k!=W; ++k) { ret.lanes[k] = std::sqrt(a.lanes[k]); } return ret; }
+	
+	// horizontal sum of the lanes
+	friend constexpr T reduceAdd(const Pack& a) { T ret = T(0); for (Size k=0; k!=W; ++k) { ret += a.lanes[k]; } return ret; }
+};
+
+template<typename T, unsigned int W>
+struct NumTraits< Pack<T,W> >
+{
+	using Real = Pack<T,W>;
+	
+	static constexpr bool isComplex = false;
+	static constexpr Real epsilon   = Real(NumTraits<T>::epsilon);
+	static constexpr Real max       = Real(NumTraits<T>::max);
+	static constexpr Real min       = Real(NumTraits<T>::min);
+	static constexpr Real infinity  = Real(NumTraits<T>::infinity);
+};
+
+template<unsigned int W>
+struct NumTraits< PackMask<W> >
+{
+	using Real = PackMask<W>;
+	
+	static constexpr bool isComplex = false;
+	static constexpr Real epsilon   = Real(NumTraits<bool>::epsilon);
+	static constexpr Real max       = Real(NumTraits<bool>::max);
+	static constexpr Real min       = Real(NumTraits<bool>::min);
+	static constexpr Real infinity  = Real(NumTraits<bool>::infinity);
+};
+
+template<unsigned int W> struct IsMask< PackMask<W> > : BIC::Fixed<bool, true> {};
+
+template<typename T>                     struct IsPack              : BIC::Fixed<bool, false> {};
+template<typename T, unsigned int W>     struct IsPack< Pack<T,W> > : BIC::Fixed<bool, true>  {};
+
+// packs W matrices, matrices[k] going to lane k
+template<typename T, std::size_t W, unsigned int Nrows, unsigned int Ncols>
+Matrix<Pack<T,W>, Nrows, Ncols> pack(const std::array<Matrix<T, Nrows, Ncols>, W>& matrices);
+
+// the matrix held in lane k
+template<typename T, unsigned int W, unsigned int Nrows, unsigned int Ncols>
+Matrix<T, Nrows, Ncols> extractLane(const Matrix<Pack<T,W>, Nrows, Ncols>& packed, const unsigned int k);
+
+} // namespace FSLinalg
+
+template<typename T, unsigned int W>
+struct fmt::formatter< FSLinalg::Pack<T,W> > : fmt::formatter<T>
+{
+	template <typename Context>
+	auto format(const FSLinalg::Pack<T,W>& x, Context& ctx) const 
+	{ 
+		auto out = fmt::format_to(ctx.out(), "(");
+		for (unsigned int k=0; k!=W; ++k)
+		{
+			if (k != 0) { out = fmt::format_to(out, ", "); }
+			ctx.advance_to(out);
+			out = fmt::formatter<T>::format(x.lanes[k], ctx);
+		}
+		return fmt::format_to(out, ")");
+	}
+};
+
+#include <FSLinalg/Pack_impl.hpp>
+
+#endif // FSLINALG_PACK_HPP
@@ -0,0 +1,34 @@
+#ifndef FSLINALG_PACK_IMPL_HPP
+#define FSLINALG_PACK_IMPL_HPP
+
+#include <FSLinalg/Pack.hpp>
+
+#include <cassert>
+
+namespace FSLinalg
+{
+
+template<typename T, std::size_t W, unsigned int Nrows, unsigned int Ncols>
+Matrix<Pack<T,W>, Nrows, Ncols> pack(const std::array<Matrix<T, Nrows, Ncols>, W>& matrices)
+{
+	Matrix<Pack<T,W>, Nrows, Ncols> ret;
+	for (unsigned int i=0; i!=Nrows*Ncols; ++i)
+	{
+		for (unsigned int k=0; k!=W; ++k) { ret[i].lanes[k] = matrices[k][i]; }
+	}
+	return ret;
+}
+
+template<typename T, unsigned int W, unsigned int Nrows, unsigned int Ncols>
+Matrix<T, Nrows, Ncols> extractLane(const Matrix<Pack<T,W>, Nrows, Ncols>& packed, const unsigned int k)
+{
+	assert(k < W);
+	
+	Matrix<T, Nrows, Ncols> ret;
+	for (unsigned int i=0; i!=Nrows*Ncols; ++i) { ret[i] = packed[i].lanes[k]; }
+	return ret;
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_PACK_IMPL_HPP
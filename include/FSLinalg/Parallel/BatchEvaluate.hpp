@@ -0,0 +1,47 @@
+#ifndef FSLINALG_PARALLEL_BATCH_EVALUATE_HPP
+#define FSLINALG_PARALLEL_BATCH_EVALUATE_HPP
+
+#include <FSLinalg/Parallel/ThreadPool.hpp>
+
+#include <cstddef>
+#include <span>
+#include <tuple>
+
+#ifndef FSLINALG_BATCH_CHUNK_BYTES
+#define FSLINALG_BATCH_CHUNK_BYTES 131072
+#endif
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+/*
+ * Batches are split in chunks of consecutive items whose inputs and outputs take about FSLINALG_BATCH_CHUNK_BYTES
+ * (half a typical L2 cache by default). The chunking depends on the item sizes only, not on the number of threads.
+ * 
+ * Inputs and outputs are spans: of Matrix, of scalars, of raw pointer ranges (std::span(ptr, n)), or of
+ * Matrix<Pack<T,W>,R,C> for lane-interleaved batches, where each item holds W independent matrices.
+ */
+template<typename... T> constexpr std::size_t batchChunkSize();
+
+// out[i] = builder(in[i]...) for every i, builder returning a scalar, a matrix or a matrix expression
+template<class Builder, typename Out, typename... In>
+void batchEvaluate(ThreadPool& pool, Builder&& builder, std::span<Out> out, std::span<In>... in);
+
+template<class Builder, typename Out, typename... In>
+void batchEvaluate(Builder&& builder, std::span<Out> out, std::span<In>... in) { batchEvaluate(ThreadPool::global(), std::forward<Builder>(builder), out, in...); }
+
+// sum of builder(in[i]...) over i, bitwise identical whatever the number of threads
+template<typename Result, class Builder, typename... In>
+Result batchSum(ThreadPool& pool, Builder&& builder, std::span<In>... in);
+
+template<typename Result, class Builder, typename... In>
+Result batchSum(Builder&& builder, std::span<In>... in) { return batchSum<Result>(ThreadPool::global(), std::forward<Builder>(builder), in...); }
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#include <FSLinalg/Parallel/BatchEvaluate_impl.hpp>
+
+#endif // FSLINALG_PARALLEL_BATCH_EVALUATE_HPP
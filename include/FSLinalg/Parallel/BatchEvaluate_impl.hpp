@@ -0,0 +1,81 @@
+#ifndef FSLINALG_PARALLEL_BATCH_EVALUATE_IMPL_HPP
+#define FSLINALG_PARALLEL_BATCH_EVALUATE_IMPL_HPP
+
+#include <FSLinalg/Parallel/BatchEvaluate.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+template<typename... T> 
+constexpr std::size_t batchChunkSize()
+{
+	constexpr std::size_t itemBytes = (sizeof(T) + ... + 0);
+	return std::max<std::size_t>(FSLINALG_BATCH_CHUNK_BYTES / std::max<std::size_t>(itemBytes, 1), 1);
+}
+
+template<class Builder, typename Out, typename... In>
+void batchEvaluate(ThreadPool& pool, Builder&& builder, std::span<Out> out, std::span<In>... in)
+{
+	assert(((in.size() == out.size()) and ...));
+	
+	constexpr std::size_t chunkSize = batchChunkSize<Out, In...>();
+	
+	const std::size_t n       = out.size();
+	const std::size_t nChunks = (n + chunkSize - 1)/chunkSize;
+	
+	pool.parallelFor(nChunks, [&](const std::size_t chunk) -> void
+	{
+		const std::size_t end = std::min(n, (chunk + 1)*chunkSize);
+		for (std::size_t i=chunk*chunkSize; i!=end; ++i)
+		{
+			out[i] = builder(in[i]...);
+		}
+	});
+}
+
+template<typename Result, class Builder, typename... In>
+Result batchSum(ThreadPool& pool, Builder&& builder, std::span<In>... in)
+{
+	static_assert(sizeof...(In) > 0, "batchSum needs at least one input");
+	
+	constexpr std::size_t chunkSize = batchChunkSize<Result, In...>();
+	
+	const std::size_t n       = std::get<0>(std::forward_as_tuple(in...)).size();
+	const std::size_t nChunks = (n + chunkSize - 1)/chunkSize;
+	
+	assert(((in.size() == n) and ...));
+	
+	// one partial sum per chunk, each chunk summed in order
+	std::vector<Result> partial(nChunks, Result(0));
+	pool.parallelFor(nChunks, [&](const std::size_t chunk) -> void
+	{
+		Result& acc = partial[chunk];
+		
+		const std::size_t end = std::min(n, (chunk + 1)*chunkSize);
+		for (std::size_t i=chunk*chunkSize; i!=end; ++i)
+		{
+			acc += builder(in[i]...);
+		}
+	});
+	
+	// partial sums combined pairwise along a fixed tree
+	for (std::size_t stride=1; stride<nChunks; stride*=2)
+	{
+		for (std::size_t chunk=0; chunk + stride<nChunks; chunk+=2*stride)
+		{
+			partial[chunk] += partial[chunk + stride];
+		}
+	}
+	return (nChunks == 0) ? Result(0) : partial[0];
+}
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#endif // FSLINALG_PARALLEL_BATCH_EVALUATE_IMPL_HPP
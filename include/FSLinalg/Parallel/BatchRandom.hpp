@@ -0,0 +1,46 @@
+#ifndef FSLINALG_PARALLEL_BATCH_RANDOM_HPP
+#define FSLINALG_PARALLEL_BATCH_RANDOM_HPP
+
+#include <FSLinalg/Parallel/BatchEvaluate.hpp>
+#include <FSLinalg/Random.hpp>
+
+#include <span>
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+/*
+ * Random fills of batches of records (Matrix or Tensor). Item i takes the blocks of engine following the blocks of
+ * the items before it, each item using RandomEngine::blocksFor<Distribution>(number of real entries) blocks, and the
+ * engine is moved past the whole batch. The values are therefore those of filling the items one after the other with
+ * the engine, whatever the number of threads and the chunking.
+ */
+template<class Record, class Distribution>
+void batchFill(ThreadPool& pool, RandomEngine& engine, std::span<Record> out, const Distribution& dist);
+
+template<class Record>
+void batchRandom(ThreadPool& pool, RandomEngine& engine, std::span<Record> out, const typename Record::RealScalar lb = -1, const typename Record::RealScalar ub = 1)
+{
+	batchFill(pool, engine, out, UniformDistribution<typename Record::RealScalar>{lb, ub});
+}
+
+template<class Record>
+void batchRandomNormal(ThreadPool& pool, RandomEngine& engine, std::span<Record> out, const typename Record::RealScalar mean = 0, const typename Record::RealScalar stddev = 1)
+{
+	batchFill(pool, engine, out, NormalDistribution<typename Record::RealScalar>{mean, stddev});
+}
+
+template<class Record>
+void batchRandom(RandomEngine& engine, std::span<Record> out, const typename Record::RealScalar lb = -1, const typename Record::RealScalar ub = 1) { batchRandom(ThreadPool::global(), engine, out, lb, ub); }
+
+template<class Record>
+void batchRandomNormal(RandomEngine& engine, std::span<Record> out, const typename Record::RealScalar mean = 0, const typename Record::RealScalar stddev = 1) { batchRandomNormal(ThreadPool::global(), engine, out, mean, stddev); }
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#include <FSLinalg/Parallel/BatchRandom_impl.hpp>
+
+#endif // FSLINALG_PARALLEL_BATCH_RANDOM_HPP
@@ -0,0 +1,45 @@
+#ifndef FSLINALG_PARALLEL_BATCH_RANDOM_IMPL_HPP
+#define FSLINALG_PARALLEL_BATCH_RANDOM_IMPL_HPP
+
+#include <FSLinalg/Parallel/BatchRandom.hpp>
+
+#include <algorithm>
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+template<class Record, class Distribution>
+void batchFill(ThreadPool& pool, RandomEngine& engine, std::span<Record> out, const Distribution& dist)
+{
+	using Scalar = typename Record::Scalar;
+	using Value  = typename Distribution::Value;
+	
+	static_assert(sizeof(Scalar) % sizeof(Value) == 0, "Record entries must be made of the distribution values");
+	
+	constexpr std::size_t   itemValues = Record::size*(sizeof(Scalar)/sizeof(Value));
+	constexpr std::uint64_t itemBlocks = RandomEngine::blocksFor<Distribution>(itemValues);
+	constexpr std::size_t   chunkSize  = batchChunkSize<Record>();
+	
+	const std::uint64_t first   = engine.position();
+	const std::size_t   n       = out.size();
+	const std::size_t   nChunks = (n + chunkSize - 1)/chunkSize;
+	
+	const RandomEngine& source = engine;
+	pool.parallelFor(nChunks, [&](const std::size_t chunk) -> void
+	{
+		const std::size_t end = std::min(n, (chunk + 1)*chunkSize);
+		for (std::size_t i=chunk*chunkSize; i!=end; ++i)
+		{
+			source.fillAt(first + i*itemBlocks, std::span<Value>(reinterpret_cast<Value*>(out[i].data()), itemValues), dist);
+		}
+	});
+	
+	engine.seek(first + n*itemBlocks);
+}
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#endif // FSLINALG_PARALLEL_BATCH_RANDOM_IMPL_HPP
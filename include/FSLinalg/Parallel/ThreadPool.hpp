@@ -0,0 +1,84 @@
+#ifndef FSLINALG_PARALLEL_THREAD_POOL_HPP
+#define FSLINALG_PARALLEL_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+/*
+ * Fixed set of worker threads running parallel loops over chunks.
+ * 
+ * The chunks of a loop are split in contiguous blocks, one per worker (the calling thread being one of them). A worker
+ * first runs the chunks of its own block, in order, then steals the remaining chunks of the other blocks one at a time.
+ * Which thread runs a chunk is therefore not deterministic, but the chunks themselves are: callers that need
+ * reproducible results store per-chunk results and combine them in chunk order.
+ * 
+ * A loop started from inside a running chunk, or while another thread is using the pool, runs serially on the
+ * calling thread.
+ */
+class ThreadPool
+{
+public:
+	using Size = std::size_t;
+	
+	explicit ThreadPool(const unsigned int nThreads = std::thread::hardware_concurrency());
+	~ThreadPool();
+	
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+	
+	// number of threads running a loop, including the calling thread
+	unsigned int size() const { return unsigned(m_threads.size()) + 1; }
+	
+	// f(chunk) for chunk in [0, nChunks), the first exception thrown by f is rethrown once every chunk is done
+	template<typename F> void parallelFor(const Size nChunks, F&& f);
+	
+	// shared pool, with one thread per hardware thread
+	static ThreadPool& global();
+private:
+	struct alignas(64) Block
+	{
+		std::atomic<Size> next;
+		Size              end;
+	};
+	
+	using Task = void(*)(void* context, Size chunk);
+	
+	void workerLoop(const unsigned int worker);
+	void runChunks (const unsigned int worker);
+	void run(Task task, void* context, const Size nChunks);
+	
+	std::vector<std::thread> m_threads;
+	std::unique_ptr<Block[]> m_blocks;
+	
+	std::mutex              m_submit;
+	std::mutex              m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	
+	unsigned long      m_generation;
+	unsigned int       m_active;
+	bool               m_stop;
+	Task               m_task;
+	void*              m_context;
+	std::exception_ptr m_exception;
+	
+	static thread_local bool t_inChunk;
+};
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#include <FSLinalg/Parallel/ThreadPool_impl.hpp>
+
+#endif // FSLINALG_PARALLEL_THREAD_POOL_HPP
@@ -0,0 +1,145 @@
+#ifndef FSLINALG_PARALLEL_THREAD_POOL_IMPL_HPP
+#define FSLINALG_PARALLEL_THREAD_POOL_IMPL_HPP
+
+#include <FSLinalg/Parallel/ThreadPool.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace FSLinalg
+{
+namespace Parallel
+{
+
+inline thread_local bool ThreadPool::t_inChunk = false;
+
+inline ThreadPool::ThreadPool(const unsigned int nThreads) :
+	m_blocks(new Block[std::max(nThreads, 1u)]),
+	m_generation(0),
+	m_active(0),
+	m_stop(false),
+	m_task(nullptr),
+	m_context(nullptr)
+{
+	for (unsigned int worker=1; worker<nThreads; ++worker)
+	{
+		m_threads.emplace_back([this, worker]() -> void { workerLoop(worker); });
+	}
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	{
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (std::thread& thread : m_threads) { thread.join(); }
+}
+
+inline ThreadPool& ThreadPool::global()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+template<typename F> 
+void ThreadPool::parallelFor(const Size nChunks, F&& f)
+{
+	auto task = [](void* context, const Size chunk) -> void { (*static_cast<std::remove_reference_t<F>*>(context))(chunk); };
+	
+	std::unique_lock<std::mutex> submit(m_submit, std::try_to_lock);
+	if (m_threads.empty() or nChunks < 2 or t_inChunk or not submit.owns_lock())
+	{
+		std::exception_ptr exception;
+		for (Size chunk=0; chunk!=nChunks; ++chunk)
+		{
+			try
+			{
+				f(chunk);
+			}
+			catch (...)
+			{
+				if (not exception) { exception = std::current_exception(); }
+			}
+		}
+		if (exception) { std::rethrow_exception(exception); }
+		return;
+	}
+	run(task, static_cast<void*>(std::addressof(f)), nChunks);
+}
+
+inline void ThreadPool::run(Task task, void* context, const Size nChunks)
+{
+	const unsigned int nWorkers = size();
+	for (unsigned int worker=0; worker!=nWorkers; ++worker)
+	{
+		m_blocks[worker].next.store(nChunks*worker/nWorkers, std::memory_order_relaxed);
+		m_blocks[worker].end = nChunks*(worker + 1)/nWorkers;
+	}
+	
+	{
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		m_task      = task;
+		m_context   = context;
+		m_exception = nullptr;
+		m_active    = nWorkers - 1;
+		++m_generation;
+	}
+	m_wake.notify_all();
+	
+	runChunks(0);
+	
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() -> bool { return m_active == 0; });
+	
+	if (m_exception) { std::rethrow_exception(std::exchange(m_exception, nullptr)); }
+}
+
+inline void ThreadPool::workerLoop(const unsigned int worker)
+{
+	unsigned long seen = 0;
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() -> bool { return m_stop or m_generation != seen; });
+			if (m_stop) { return; }
+			seen = m_generation;
+		}
+		
+		runChunks(worker);
+		
+		const std::lock_guard<std::mutex> lock(m_mutex);
+		if (--m_active == 0) { m_done.notify_one(); }
+	}
+}
+
+inline void ThreadPool::runChunks(const unsigned int worker)
+{
+	const unsigned int nWorkers = size();
+	
+	t_inChunk = true;
+	for (unsigned int offset=0; offset!=nWorkers; ++offset)
+	{
+		Block& block = m_blocks[(worker + offset) % nWorkers];
+		for (Size chunk = block.next.fetch_add(1, std::memory_order_relaxed); chunk < block.end; chunk = block.next.fetch_add(1, std::memory_order_relaxed))
+		{
+			try
+			{
+				m_task(m_context, chunk);
+			}
+			catch (...)
+			{
+				const std::lock_guard<std::mutex> lock(m_mutex);
+				if (not m_exception) { m_exception = std::current_exception(); }
+			}
+		}
+	}
+	t_inChunk = false;
+}
+
+} // namespace Parallel
+} // namespace FSLinalg
+
+#endif // FSLINALG_PARALLEL_THREAD_POOL_IMPL_HPP
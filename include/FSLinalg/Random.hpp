@@ -0,0 +1,129 @@
+#ifndef FSLINALG_RANDOM_HPP
+#define FSLINALG_RANDOM_HPP
+
+#include <array>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace FSLinalg
+{
+
+/*
+ * Philox4x32-10 block function (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3"): a keyed bijection
+ * of 128-bit counters, whose outputs pass BigCrush for any sequence of distinct counters.
+ * generate() evaluates lanes counters at once in structure-of-arrays layout: each round is a plain loop over independent
+ * lanes, which the compiler is free to auto-vectorize.
+ */
+struct Philox4x32
+{
+	using Word    = std::uint32_t;
+	using Counter = std::array<Word, 4>;
+	using Key     = std::array<Word, 2>;
+	
+	static constexpr unsigned int rounds = 10;
+	
+	static constexpr Counter block(Counter counter, Key key);
+	
+	// words[w][l] = block(counter of lane l, key)[w], where lane l counts firstBlock + l on the low words and stream on the high words
+	template<std::size_t lanes>
+	static constexpr void generate(const Key& key, const std::uint64_t stream, const std::uint64_t firstBlock, Word (&words)[4][lanes]);
+};
+
+/*
+ * Distributions turning one Philox block into valuesPerBlock values. Floating point values take 24 (float) or
+ * 53 (double and wider) random bits; normal values come in pairs from the Box-Muller transform.
+ */
+template<std::floating_point T>
+struct UniformDistribution
+{
+	using Value = T;
+	
+	static constexpr std::size_t valuesPerBlock = (std::numeric_limits<T>::digits <= 24) ? 4 : 2;
+	
+	T lb = T(0);
+	T ub = T(1);
+	
+	constexpr void operator()(const Philox4x32::Word (&words)[4], T* dst) const;
+};
+
+template<std::floating_point T>
+struct NormalDistribution
+{
+	using Value = T;
+	
+	static constexpr std::size_t valuesPerBlock = (std::numeric_limits<T>::digits <= 24) ? 4 : 2;
+	
+	T mean   = T(0);
+	T stddev = T(1);
+	
+	void operator()(const Philox4x32::Word (&words)[4], T* dst) const;
+};
+
+/*
+ * Counter-based random engine: the k-th block of (seed, stream) is Philox4x32 of the counter (k, stream) under the
+ * key seed, so that every value is addressable and streams are independent. Constructing an engine costs nothing.
+ *
+ * The engine is a standard uniform random bit generator of 32-bit words, and fills spans block-wise: a fill starts at
+ * the next unused block and consumes ceil(n / valuesPerBlock) blocks. fillAt() reads explicit blocks without
+ * moving the engine, which is what the batch fills use to give each item its own blocks (see Parallel/BatchRandom.hpp).
+ */
+class RandomEngine
+{
+public:
+	using result_type = Philox4x32::Word;
+	
+	static constexpr std::uint64_t defaultSeed = 0x853c49e6748fea9bULL;
+	
+	explicit constexpr RandomEngine(const std::uint64_t seed = defaultSeed, const std::uint64_t stream = 0);
+	
+	static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+	static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+	
+	constexpr result_type operator()();
+	
+	// skips n words
+	constexpr void discard(unsigned long long n);
+	
+	constexpr std::uint64_t seed()   const { return m_seed;   }
+	constexpr std::uint64_t stream() const { return m_stream; }
+	
+	// index of the next unused block, a partially used block counting as used
+	constexpr std::uint64_t position() const { return m_block; }
+	constexpr void          seek(const std::uint64_t block) { m_block = block; m_used = 4; }
+	
+	template<class Distribution> static constexpr std::uint64_t blocksFor(const std::size_t n) { return (n + Distribution::valuesPerBlock - 1)/Distribution::valuesPerBlock; }
+	
+	template<class Distribution> void fill  (std::span<typename Distribution::Value> out, const Distribution& dist);
+	template<class Distribution> void fillAt(const std::uint64_t block, std::span<typename Distribution::Value> out, const Distribution& dist) const;
+	
+	template<std::floating_point T> void fillUniform(std::span<T>               out, const T lb = T(0), const T ub = T(1)) { fill(out, UniformDistribution<T>{lb, ub}); }
+	template<std::floating_point T> void fillUniform(std::span<std::complex<T>> out, const T lb = T(0), const T ub = T(1)) { fillUniform(realParts(out), lb, ub); }
+	
+	template<std::floating_point T> void fillNormal(std::span<T>               out, const T mean = T(0), const T stddev = T(1)) { fill(out, NormalDistribution<T>{mean, stddev}); }
+	template<std::floating_point T> void fillNormal(std::span<std::complex<T>> out, const T mean = T(0), const T stddev = T(1)) { fillNormal(realParts(out), mean, stddev); }
+	
+	// engine of the calling thread, seeded with defaultSeed; threads take streams 0, 1, ... in order of first use
+	static RandomEngine& threadLocal();
+	
+	// real and imaginary parts of z, interleaved
+	template<std::floating_point T>
+	static std::span<T> realParts(std::span<std::complex<T>> z) { return std::span<T>(reinterpret_cast<T*>(z.data()), 2*z.size()); }
+private:
+	constexpr Philox4x32::Key key() const { return {Philox4x32::Word(m_seed), Philox4x32::Word(m_seed >> 32)}; }
+	
+	std::uint64_t       m_seed;
+	std::uint64_t       m_stream;
+	std::uint64_t       m_block;
+	Philox4x32::Counter m_buffer;
+	unsigned int        m_used;
+};
+
+} // namespace FSLinalg
+
+#include <FSLinalg/Random_impl.hpp>
+
+#endif // FSLINALG_RANDOM_HPP
@@ -0,0 +1,182 @@
+#ifndef FSLINALG_RANDOM_IMPL_HPP
+#define FSLINALG_RANDOM_IMPL_HPP
+
+#include <FSLinalg/Random.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numbers>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+inline constexpr Philox4x32::Word philoxM0 = 0xD2511F53;
+inline constexpr Philox4x32::Word philoxM1 = 0xCD9E8D57;
+inline constexpr Philox4x32::Word philoxW0 = 0x9E3779B9;
+inline constexpr Philox4x32::Word philoxW1 = 0xBB67AE85;
+
+// uniform in [0, 1) from the high bits of the words
+template<typename T> constexpr T unitFromWord (const std::uint32_t w)                        { return T(w >> 8)*T(0x1p-24); }
+template<typename T> constexpr T unitFromWords(const std::uint32_t lo, const std::uint32_t hi) { return T(((std::uint64_t(hi) << 32) | lo) >> 11)*T(0x1p-53); }
+
+template<typename T>
+void boxMuller(const T u1, const T u2, const T mean, const T stddev, T* dst)
+{
+	// 1 - u1 is in (0, 1]
+	const T r     = stddev*std::sqrt(T(-2)*std::log(T(1) - u1));
+	const T theta = T(2)*std::numbers::pi_v<T>*u2;
+	dst[0] = mean + r*std::cos(theta);
+	dst[1] = mean + r*std::sin(theta);
+}
+
+} // namespace detail
+
+constexpr Philox4x32::Counter Philox4x32::block(Counter counter, Key key)
+{
+	for (unsigned int r=0; r!=rounds; ++r)
+	{
+		if (r != 0) { key[0] += detail::philoxW0; key[1] += detail::philoxW1; }
+	
+		const std::uint64_t p0 = std::uint64_t(detail::philoxM0)*counter[0];
+		const std::uint64_t p1 = std::uint64_t(detail::philoxM1)*counter[2];
+		counter = {Word(p1 >> 32) ^ counter[1] ^ key[0], Word(p1), Word(p0 >> 32) ^ counter[3] ^ key[1], Word(p0)};
+	}
+	return counter;
+}
+
+template<std::size_t lanes>
+constexpr void Philox4x32::generate(const Key& key, const std::uint64_t stream, const std::uint64_t firstBlock, Word (&words)[4][lanes])
+{
+	for (std::size_t l=0; l!=lanes; ++l)
+	{
+		const std::uint64_t k = firstBlock + l;
+		words[0][l] = Word(k);
+		words[1][l] = Word(k >> 32);
+		words[2][l] = Word(stream);
+		words[3][l] = Word(stream >> 32);
+	}
+	
+	Key roundKey = key;
+	for (unsigned int r=0; r!=rounds; ++r)
+	{
+		if (r != 0) { roundKey[0] += detail::philoxW0; roundKey[1] += detail::philoxW1; }
+	
+		for (std::size_t l=0; l!=lanes; ++l)
+		{
+			const std::uint64_t p0 = std::uint64_t(detail::philoxM0)*words[0][l];
+			const std::uint64_t p1 = std::uint64_t(detail::philoxM1)*words[2][l];
+			const Word c1 = words[1][l];
+			const Word c3 = words[3][l];
+			words[0][l] = Word(p1 >> 32) ^ c1 ^ roundKey[0];
+			words[1][l] = Word(p1);
+			words[2][l] = Word(p0 >> 32) ^ c3 ^ roundKey[1];
+			words[3][l] = Word(p0);
+		}
+	}
+}
+
+template<std::floating_point T>
+constexpr void UniformDistribution<T>::operator()(const Philox4x32::Word (&words)[4], T* dst) const
+{
+	const T scale = ub - lb;
+	if constexpr (valuesPerBlock == 4)
+	{
+		for (unsigned int w=0; w!=4; ++w) { dst[w] = lb + scale*detail::unitFromWord<T>(words[w]); }
+	}
+	else
+	{
+		dst[0] = lb + scale*detail::unitFromWords<T>(words[0], words[1]);
+		dst[1] = lb + scale*detail::unitFromWords<T>(words[2], words[3]);
+	}
+}
+
+template<std::floating_point T>
+void NormalDistribution<T>::operator()(const Philox4x32::Word (&words)[4], T* dst) const
+{
+	if constexpr (valuesPerBlock == 4)
+	{
+		detail::boxMuller(detail::unitFromWord<T>(words[0]), detail::unitFromWord<T>(words[1]), mean, stddev, dst);
+		detail::boxMuller(detail::unitFromWord<T>(words[2]), detail::unitFromWord<T>(words[3]), mean, stddev, dst + 2);
+	}
+	else
+	{
+		detail::boxMuller(detail::unitFromWords<T>(words[0], words[1]), detail::unitFromWords<T>(words[2], words[3]), mean, stddev, dst);
+	}
+}
+
+constexpr RandomEngine::RandomEngine(const std::uint64_t seed, const std::uint64_t stream) :
+	m_seed(seed),
+	m_stream(stream),
+	m_block(0),
+	m_buffer{},
+	m_used(4)
+{}
+
+constexpr auto RandomEngine::operator()() -> result_type
+{
+	if (m_used == 4)
+	{
+		m_buffer = Philox4x32::block({Philox4x32::Word(m_block), Philox4x32::Word(m_block >> 32), Philox4x32::Word(m_stream), Philox4x32::Word(m_stream >> 32)}, key());
+		m_used   = 0;
+		++m_block;
+	}
+	return m_buffer[m_used++];
+}
+
+constexpr void RandomEngine::discard(unsigned long long n)
+{
+	const unsigned long long buffered = 4 - m_used;
+	if (n <= buffered) { m_used += unsigned(n); return; }
+	
+	n -= buffered;
+	m_block += n/4;
+	m_used   = 4;
+	for (unsigned long long w=0; w!=n%4; ++w) { (*this)(); }
+}
+
+template<class Distribution>
+void RandomEngine::fill(std::span<typename Distribution::Value> out, const Distribution& dist)
+{
+	fillAt(m_block, out, dist);
+	seek(m_block + blocksFor<Distribution>(out.size()));
+}
+
+template<class Distribution>
+void RandomEngine::fillAt(const std::uint64_t block, std::span<typename Distribution::Value> out, const Distribution& dist) const
+{
+	using Value = typename Distribution::Value;
+	
+	constexpr std::size_t lanes          = 8;
+	constexpr std::size_t valuesPerBlock = Distribution::valuesPerBlock;
+	
+	Philox4x32::Word words[4][lanes];
+	Value            values[lanes*valuesPerBlock];
+	
+	const Philox4x32::Key k = key();
+	for (std::size_t done=0, b=0; done < out.size(); done += lanes*valuesPerBlock, b += lanes)
+	{
+		Philox4x32::generate(k, m_stream, block + b, words);
+		for (std::size_t l=0; l!=lanes; ++l)
+		{
+			const Philox4x32::Word blockWords[4] = {words[0][l], words[1][l], words[2][l], words[3][l]};
+			dist(blockWords, values + l*valuesPerBlock);
+		}
+		std::copy_n(values, std::min(lanes*valuesPerBlock, out.size() - done), out.data() + done);
+	}
+}
+
+inline RandomEngine& RandomEngine::threadLocal()
+{
+	static std::atomic<std::uint64_t> nextStream = 0;
+	
+	thread_local RandomEngine engine(defaultSeed, nextStream++);
+	return engine;
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_RANDOM_IMPL_HPP
@@ -20,20 +20,26 @@ template<typename T> struct IsRealScalar    : BIC::Fixed<bool, RealScalar_concep
 template<typename T> struct IsComplexScalar : BIC::Fixed<bool, ComplexScalar_concept<T> > {};
 
 template<RealScalar_concept T> constexpr const T& real (const T& v) { return v;           }
-template<RealScalar_concept T> constexpr       T  imag (const T&  ) { return 0;           }
+template<RealScalar_concept T> constexpr       T  imag (const T&  ) { return T(0);        }
 template<RealScalar_concept T> constexpr const T& conj (const T& v) { return v;           }
-template<RealScalar_concept T>           const T& abs  (const T& v) { return std::abs(v); }
-template<RealScalar_concept T>           const T& abs2 (const T& v) { return v*v;         }
+template<RealScalar_concept T>                 T  abs  (const T& v) { using std::abs; return abs(v); }
+template<RealScalar_concept T> constexpr       T  abs2 (const T& v) { return v*v;         }
 
 template<RealScalar_concept T> T& conjInPlace(T& v) { return v; }
 
 template<RealScalar_concept T> constexpr const T&        real (const std::complex<T>& z) { return reinterpret_cast<const T(&)[2]>(z)[0]; }
 template<RealScalar_concept T> constexpr const T&        imag (const std::complex<T>& z) { return reinterpret_cast<const T(&)[2]>(z)[1]; }
-template<RealScalar_concept T>           std::complex<T> conj (const std::complex<T>& z) { return z.conj();                              }
+template<RealScalar_concept T>           std::complex<T> conj (const std::complex<T>& z) { return std::conj(z);                           }
 template<RealScalar_concept T>           T               abs  (const std::complex<T>& z) { return std::abs(z);                           }
 template<RealScalar_concept T>           T               abs2 (const std::complex<T>& z) { return real(z)*real(z) + imag(z)*imag(z);     }
 
-template<RealScalar_concept T> T& conjInPlace(std::complex<T>& z) { reinterpret_cast<const T(&)[2]>(z)[1] = -reinterpret_cast<const T(&)[2]>(z)[1]; return z; }
+template<RealScalar_concept T> std::complex<T>& conjInPlace(std::complex<T>& z) { reinterpret_cast<T(&)[2]>(z)[1] = -reinterpret_cast<T(&)[2]>(z)[1]; return z; }
+
+// results of scalar comparisons: bool, or one bool per lane for packed scalars, reduced with all and any
+template<typename T> struct IsMask : BIC::Fixed<bool, std::is_same<T, bool>::value> {};
+
+constexpr bool all(const bool b) { return b; }
+constexpr bool any(const bool b) { return b; }
 
 } // namespace FSLinalg
 
@@ -1,8 +1,17 @@
 #include <FSLinalg/Tensor/Formater.hpp>
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorView.hpp>
+#include <FSLinalg/Tensor/TensorMap.hpp>
 #include <FSLinalg/Tensor/TensorBinaryOp.hpp>
+#include <FSLinalg/Tensor/TensorScale.hpp>
+#include <FSLinalg/Tensor/TensorMinus.hpp>
+#include <FSLinalg/Tensor/TensorPermuted.hpp>
+#include <FSLinalg/Tensor/TensorReduction.hpp>
+#include <FSLinalg/Tensor/SymmetricTensor4.hpp>
 
 #include <FSLinalg/Tensor/TensorBase_impl.hpp>
 #include <FSLinalg/Tensor/Tensor_impl.hpp>
 #include <FSLinalg/Tensor/TensorBinaryOp_impl.hpp>
+#include <FSLinalg/Tensor/TensorReduction_impl.hpp>
+#include <FSLinalg/Tensor/SymmetricTensor4_impl.hpp>
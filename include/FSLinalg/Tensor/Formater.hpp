@@ -3,69 +3,80 @@
 
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/misc/NestedLoop.hpp>
+#include <FSLinalg/misc/FormatSpec.hpp>
 
 #include <fmt/core.h>
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <string_view>
+
+// the spec is parsed once per call (see misc::FormatSpec), column-major listing the entries of each 2D slice by column
 template<FSLinalg::Tensor_concept Expr>
 class fmt::formatter< Expr > : public fmt::formatter< typename FSLinalg::TensorBase<Expr>::Scalar >
 {
 public:
+	using Base = fmt::formatter< typename FSLinalg::TensorBase<Expr>::Scalar >;
+	
 	static_assert(Expr::hasReadRandomAccess, "Tensor must have a read random access Iterator");
 	
-	constexpr auto parse(fmt::format_parse_context& ctx) { return ctx.begin(); }
+	template<typename ParseContext>
+	constexpr auto parse(ParseContext& ctx) 
+	{ 
+		m_spec.parse(ctx);
+		return Base::parse(ctx); 
+	}
 	
 	template <typename Context>
 	auto format (const FSLinalg::TensorBase<Expr>& T, Context& ctx) const 
 	{
 		using Size  = typename FSLinalg::TensorBase<Expr>::Size;
 		using Shape = typename FSLinalg::TensorBase<Expr>::Shape;
-				
-		auto out = ctx.out();
+		
+		const auto entry = [this, &ctx](const auto& value) -> void { ctx.advance_to(Base::format(value, ctx)); };
+		const auto text  = [&ctx](const std::string_view str) -> void { ctx.advance_to(std::copy(std::cbegin(str), std::cend(str), ctx.out())); };
 		
 		if constexpr (Expr::rank >= 2)
 		{
-			const Size rowsM1 = Size(T.shape[Expr::rank-2]-1);
-			const Size colsM1 = Size(T.shape[Expr::rank-1]-1);
+			constexpr Size rowDim = Expr::rank-2;
+			constexpr Size colDim = Expr::rank-1;
+			
+			// outer loop on rows (or on columns when column-major)
+			const Size outerDim = m_spec.columnMajor ? colDim : rowDim;
+			const Size innerDim = m_spec.columnMajor ? rowDim : colDim;
 			
 			Shape index;
 			FSLinalg::misc::NestedLoop<0,Expr::rank-2>::run(Expr::shape, index, [&](const Shape& /* index */) -> void
 			{
-				if constexpr (Expr::rank > 2) { out = format_to(out, "[{},:,:]\n", fmt::join(std::cbegin(index), std::cend(index)-2, ",")); }
-				out = format_to(out, "[");
-				for (index[Expr::rank-2]=0; index[Expr::rank-2]!=rowsM1; ++index[Expr::rank-2])
-				{
-					out = format_to(out, "[");
-					for (index[Expr::rank-1]=0; index[Expr::rank-1]!=colsM1; ++index[Expr::rank-1])
-					{
-						out = format_to(out, "{}, ", T(index));
-					}
-					index[Expr::rank-1] = colsM1;
-					out = format_to(out, "{}]\n", T(index));
-				}
+				if constexpr (Expr::rank > 2) { ctx.advance_to(fmt::format_to(ctx.out(), "[{},:,:]\n", fmt::join(std::cbegin(index), std::cend(index)-2, ","))); }
+				text("[");
+				for (index[outerDim]=0; index[outerDim]!=Expr::shape[outerDim]; ++index[outerDim])
 				{
-					index[Expr::rank-2] = rowsM1;
-					out = format_to(out, "[");
-					for (index[Expr::rank-1]=0; index[Expr::rank-1]!=colsM1; ++index[Expr::rank-1])
+					text("[");
+					for (index[innerDim]=0; index[innerDim]!=Expr::shape[innerDim]; ++index[innerDim])
 					{
-						out = format_to(out, "{}, ", T(index));
+						entry(T(index));
+						if (index[innerDim]+1 != Expr::shape[innerDim]) { text(m_spec.separator); }
 					}
-					index[Expr::rank-1] = colsM1;
-					out = format_to(out, "{}]]\n", T(index));
+					text((index[outerDim]+1 != Expr::shape[outerDim]) ? "]\n" : "]]\n");
 				}
 			});
-			return out;
 		}
 		else
 		{
-			out = format_to(out, "[");
+			text("[");
 			for (Size i=0; i!=Size(Expr::size-1); ++i)
 			{
-				out = format_to(out, "{}, ", T[i]);
+				entry(T[i]);
+				text(m_spec.separator);
 			}
-			return format_to(out, "{}]", T[Size(Expr::size-1)]);
+			entry(T[Size(Expr::size-1)]);
+			text("]");
 		}
+		return ctx.out();
 	}
+private:
+	FSLinalg::misc::FormatSpec m_spec;
 };
 
 #endif // FSLINALG_TENSOR_FORMATER_HPP
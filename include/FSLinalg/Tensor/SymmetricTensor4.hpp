@@ -0,0 +1,196 @@
+#ifndef FSLINALG_SYMMETRIC_TENSOR4_HPP
+#define FSLINALG_SYMMETRIC_TENSOR4_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorUtils.hpp>
+#include <FSLinalg/Matrix/Matrix.hpp>
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <utility>
+
+namespace FSLinalg
+{
+
+// index symmetries of a rank-4 tensor C, each level including the previous ones
+enum class Symmetry4
+{
+	Minor, // C_ijkl = C_jikl = C_ijlk
+	Major, // and C_ijkl = C_klij, as elasticity tensors
+	Full   // invariant under any permutation of ijkl
+};
+
+namespace detail
+{
+
+// representative of the orbit of C_ijkl, for ij and kl the pairs p and q, p coming first in Voigt order when ordered is set
+template<Symmetry4 symmetry>
+constexpr std::array<unsigned int, 4> orbitKey(const std::array<unsigned int, 2>& p, const std::array<unsigned int, 2>& q, const bool ordered)
+{
+	std::array<unsigned int, 4> ret = {p[0], p[1], q[0], q[1]};
+	if constexpr (symmetry == Symmetry4::Major) { if (not ordered) { ret = {q[0], q[1], p[0], p[1]}; } }
+	if constexpr (symmetry == Symmetry4::Full)  { std::sort(ret.begin(), ret.end()); }
+	return ret;
+}
+
+/*
+ * Storage of a symmetric rank-4 tensor: the symmetric index pairs ij are numbered in Voigt order (the diagonal, then
+ * (1,2), (0,2), (0,1) in 3D) and each entry C_IJ of the n x n Voigt matrix goes to the slot of its orbit under the
+ * symmetry, slots being numbered in row-major order of their first entry.
+ */
+template<unsigned int dim, Symmetry4 symmetry>
+struct SymmetricLayout4
+{
+	using Size = unsigned int;
+	using Pair = std::array<Size, 2>;
+	
+	static constexpr Size n = dim*(dim + 1)/2;
+	
+	static constexpr std::array<Pair, n> pairs = []() -> std::array<Pair, n>
+	{
+		std::array<Pair, n> ret{};
+		Size I = 0;
+		for (Size d=0; d!=dim; ++d) { ret[I++] = {d, d}; }
+		for (Size j=dim; j-- > 1; ) { for (Size i=j; i-- > 0; ) { ret[I++] = {i, j}; } }
+		return ret;
+	}();
+	
+	static constexpr std::array<Size, dim*dim> voigt = []() -> std::array<Size, dim*dim>
+	{
+		std::array<Size, dim*dim> ret{};
+		for (Size I=0; I!=n; ++I) { ret[pairs[I][0]*dim + pairs[I][1]] = I; ret[pairs[I][1]*dim + pairs[I][0]] = I; }
+		return ret;
+	}();
+	
+	// slots of the Voigt entries, and their number
+	static constexpr std::pair<std::array<Size, n*n>, Size> slotsAndCount = []() -> std::pair<std::array<Size, n*n>, Size>
+	{
+		std::array<Size, n*n> ret{};
+		Size count = 0;
+		for (Size IJ=0; IJ!=n*n; ++IJ)
+		{
+			Size first = 0;
+			while (orbitKey<symmetry>(pairs[first/n], pairs[first%n], first/n <= first%n) != orbitKey<symmetry>(pairs[IJ/n], pairs[IJ%n], IJ/n <= IJ%n)) { ++first; }
+			ret[IJ] = (first == IJ) ? count++ : ret[first];
+		}
+		return {ret, count};
+	}();
+	
+	static constexpr Size nStored = slotsAndCount.second;
+	
+	static constexpr std::array<Size, n*n> slots = slotsAndCount.first;
+	
+	static constexpr Size slotOf(const Size i, const Size j, const Size k, const Size l) { return slots[voigt[i*dim + j]*n + voigt[k*dim + l]]; }
+	
+	// slots of the dim^4 entries in row-major order
+	static constexpr std::array<Size, dim*dim*dim*dim> flatSlots = []() -> std::array<Size, dim*dim*dim*dim>
+	{
+		std::array<Size, dim*dim*dim*dim> ret{};
+		for (Size f=0; f!=ret.size(); ++f) { ret[f] = slots[voigt[f/(dim*dim)]*n + voigt[f%(dim*dim)]]; }
+		return ret;
+	}();
+	
+	// number of tensor entries sharing each slot, and of tensor entries of the Voigt entries of a pair
+	static constexpr std::array<Size, nStored> counts = []() -> std::array<Size, nStored> { std::array<Size, nStored> ret{}; for (const Size s : flatSlots) { ++ret[s]; } return ret; }();
+	
+	static constexpr Size multiplicity(const Size I) { return (I < dim) ? 1 : 2; }
+};
+
+} // namespace detail
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry> class SymmetricTensor4;
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+struct TensorTraits< SymmetricTensor4<T, dim, symmetry> >
+{
+	using Scalar = T;
+	using Size   = unsigned int;
+	using Shape  = std::array<Size, 4>;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool hasStridedAccess     = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = true;
+	
+	static constexpr Shape shape   = Shape({dim, dim, dim, dim});
+	static constexpr Shape strides = TensorUtils::getStrides(shape);
+};
+
+/*
+ * Rank-4 tensor of dimension dim storing one value per orbit of its index symmetries: 36, 21 and 15 values instead of
+ * 81 for minor, major and full symmetry in 3D. It reads as a Tensor, symmetric entries being written at once through
+ * slot(), and converts to and from the n x n Voigt and Mandel matrices, n = dim*(dim+1)/2. The double contractions C : eps
+ * run on the storage as n x n matrix-vector products.
+ */
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+class SymmetricTensor4 : public TensorBase< SymmetricTensor4<T, dim, symmetry> >
+{
+public:
+	using Self = SymmetricTensor4<T, dim, symmetry>;
+	FSLINALG_DEFINE_TENSOR
+	
+	using Layout = detail::SymmetricLayout4<dim, symmetry>;
+	
+	static constexpr Size n       = Layout::n;
+	static constexpr Size nStored = Layout::nStored;
+	
+	using VoigtMatrix  = Matrix<T, n, n>;
+	using MandelMatrix = Matrix<T, n, n>;
+	using MandelVector = Matrix<T, n, 1>;
+	
+	SymmetricTensor4(const T& value = T(0)) { m_data.fill(value); }
+	
+	// projection on the symmetric tensors: each value is the mean of the entries of its orbit
+	template<class Expr> explicit SymmetricTensor4(const TensorBase<Expr>& expr) requires(std::is_convertible<typename Expr::Scalar, T>::value);
+	
+	// C_IJ = C_ijkl, ij and kl being the pairs of I and J, projected like tensors
+	static SymmetricTensor4 fromVoigt(const VoigtMatrix& C);
+	VoigtMatrix             toVoigt() const;
+	
+	// C_IJ = w_I*w_J*C_ijkl, w being 1 on the diagonal pairs and sqrt(2) on the others, so that mandel(C : eps) = C*mandel(eps)
+	static SymmetricTensor4 fromMandel(const MandelMatrix& C);
+	MandelMatrix            toMandel() const;
+	
+	// Mandel vector of a symmetric rank-2 tensor (the symmetric part of a), and its inverse
+	static MandelVector      mandel  (const Tensor<T, dim, dim>& a);
+	static Tensor<T,dim,dim> unmandel(const MandelVector& v);
+	
+	SymmetricTensor4& operator+=(const SymmetricTensor4& other) { for (Size s=0; s!=nStored; ++s) { m_data[s] += other.m_data[s]; } return *this; }
+	SymmetricTensor4& operator-=(const SymmetricTensor4& other) { for (Size s=0; s!=nStored; ++s) { m_data[s] -= other.m_data[s]; } return *this; }
+	
+	SymmetricTensor4& operator*=(const T& alpha) { for (Size s=0; s!=nStored; ++s) { m_data[s] *= alpha; } return *this; }
+	SymmetricTensor4& operator/=(const T& alpha) { for (Size s=0; s!=nStored; ++s) { m_data[s] /= alpha; } return *this; }
+	
+	const T* data() const { return m_data.data(); }
+	      T* data()       { return m_data.data(); }
+	
+	// stored value of C_ijkl, shared by its symmetric images
+	const T& slot(const Size i, const Size j, const Size k, const Size l) const { return m_data[Layout::slotOf(i, j, k, l)]; }
+	      T& slot(const Size i, const Size j, const Size k, const Size l)       { return m_data[Layout::slotOf(i, j, k, l)]; }
+	
+	const_ReturnType getImpl(const Size i) const { return m_data[Layout::flatSlots[i]]; }
+	
+	template<std::integral... Idx> const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank) { return m_data[Layout::slotOf(Size(idx)...)]; }
+	
+	template<class Dst> constexpr bool isAliasedToImpl(const TensorBase<Dst>&) const { return false; }
+private:
+	std::array<T, nStored> m_data;
+};
+
+// (C : eps)_ij = C_ijkl*eps_kl
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+Tensor<T, dim, dim> doubleContraction(const SymmetricTensor4<T, dim, symmetry>& C, const Tensor<T, dim, dim>& eps);
+
+// the same on Mandel vectors
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+typename SymmetricTensor4<T, dim, symmetry>::MandelVector doubleContraction(const SymmetricTensor4<T, dim, symmetry>& C, const typename SymmetricTensor4<T, dim, symmetry>::MandelVector& eps);
+
+template<unsigned int dim> using ElasticityTensor = SymmetricTensor4<double, dim, Symmetry4::Major>;
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_SYMMETRIC_TENSOR4_HPP
@@ -0,0 +1,171 @@
+#ifndef FSLINALG_SYMMETRIC_TENSOR4_IMPL_HPP
+#define FSLINALG_SYMMETRIC_TENSOR4_IMPL_HPP
+
+#include <FSLinalg/Tensor/SymmetricTensor4.hpp>
+#include <FSLinalg/misc/NestedLoop.hpp>
+
+#include <numbers>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+// weight of the pair I in Mandel vectors and matrices
+template<std::floating_point T, unsigned int dim>
+constexpr T mandelWeight(const unsigned int I) { return (I < dim) ? T(1) : std::numbers::sqrt2_v<T>; }
+
+// product of the weights of I and J, exactly 2 for two off-diagonal pairs
+template<std::floating_point T, unsigned int dim>
+constexpr T mandelWeight(const unsigned int I, const unsigned int J) { return (I >= dim and J >= dim) ? T(2) : mandelWeight<T,dim>(I)*mandelWeight<T,dim>(J); }
+
+// s = C*e for the Voigt matrix C of the storage c, every slot being read in place
+template<class Layout, std::floating_point T>
+void voigtProduct(const T* c, const std::array<T, Layout::n>& e, std::array<T, Layout::n>& s)
+{
+	constexpr unsigned int n = Layout::n;
+	
+	for (unsigned int I=0; I!=n; ++I)
+	{
+		T acc = T(0);
+		for (unsigned int J=0; J!=n; ++J) { acc += c[Layout::slots[I*n + J]]*e[J]; }
+		s[I] = acc;
+	}
+}
+
+} // namespace detail
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry> template<class Expr>
+SymmetricTensor4<T,dim,symmetry>::SymmetricTensor4(const TensorBase<Expr>& expr) requires(std::is_convertible<typename Expr::Scalar, T>::value) :
+	m_data{}
+{
+	static_assert(Expr::shape == shape, "Tensor shapes must match");
+	
+	using Operand = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, TensorFromShape<typename Expr::Scalar, Expr::shape> >;
+	
+	const Operand x(expr.derived());
+	
+	misc::nestedLoop(shape, [&](const Shape& index) -> void { m_data[Layout::slotOf(index[0], index[1], index[2], index[3])] += T(x(index)); });
+	for (Size s=0; s!=nStored; ++s) { m_data[s] /= T(Layout::counts[s]); }
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+auto SymmetricTensor4<T,dim,symmetry>::fromVoigt(const VoigtMatrix& C) -> SymmetricTensor4
+{
+	// the Voigt entry C_IJ stands for multiplicity(I)*multiplicity(J) tensor entries
+	SymmetricTensor4 ret(T(0));
+	for (Size I=0; I!=n; ++I)
+	{
+		for (Size J=0; J!=n; ++J) { ret.m_data[Layout::slots[I*n + J]] += T(Layout::multiplicity(I)*Layout::multiplicity(J))*C(I,J); }
+	}
+	for (Size s=0; s!=nStored; ++s) { ret.m_data[s] /= T(Layout::counts[s]); }
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+auto SymmetricTensor4<T,dim,symmetry>::toVoigt() const -> VoigtMatrix
+{
+	VoigtMatrix ret(T(0));
+	for (Size IJ=0; IJ!=n*n; ++IJ) { ret[IJ] = m_data[Layout::slots[IJ]]; }
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+auto SymmetricTensor4<T,dim,symmetry>::fromMandel(const MandelMatrix& C) -> SymmetricTensor4
+{
+	VoigtMatrix voigt(T(0));
+	for (Size I=0; I!=n; ++I)
+	{
+		for (Size J=0; J!=n; ++J) { voigt(I,J) = C(I,J)/detail::mandelWeight<T,dim>(I,J); }
+	}
+	return fromVoigt(voigt);
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+auto SymmetricTensor4<T,dim,symmetry>::toMandel() const -> MandelMatrix
+{
+	MandelMatrix ret(T(0));
+	for (Size I=0; I!=n; ++I)
+	{
+		for (Size J=0; J!=n; ++J) { ret(I,J) = detail::mandelWeight<T,dim>(I,J)*m_data[Layout::slots[I*n + J]]; }
+	}
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+auto SymmetricTensor4<T,dim,symmetry>::mandel(const Tensor<T, dim, dim>& a) -> MandelVector
+{
+	MandelVector ret(T(0));
+	for (Size I=0; I!=n; ++I)
+	{
+		const Size i = Layout::pairs[I][0];
+		const Size j = Layout::pairs[I][1];
+		ret[I] = (I < dim) ? a(i,j) : (a(i,j) + a(j,i))/std::numbers::sqrt2_v<T>;
+	}
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+Tensor<T,dim,dim> SymmetricTensor4<T,dim,symmetry>::unmandel(const MandelVector& v)
+{
+	Tensor<T,dim,dim> ret(T(0));
+	for (Size I=0; I!=n; ++I)
+	{
+		const Size i = Layout::pairs[I][0];
+		const Size j = Layout::pairs[I][1];
+		ret(i,j) = v[I]/detail::mandelWeight<T,dim>(I);
+		ret(j,i) = ret(i,j);
+	}
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+Tensor<T, dim, dim> doubleContraction(const SymmetricTensor4<T, dim, symmetry>& C, const Tensor<T, dim, dim>& eps)
+{
+	using Layout = typename SymmetricTensor4<T, dim, symmetry>::Layout;
+	using Size   = typename Layout::Size;
+	
+	// C_ijkl*eps_kl + C_ijlk*eps_lk = C_ijkl*(eps_kl + eps_lk): Voigt strains with engineering shears
+	std::array<T, Layout::n> e;
+	for (Size J=0; J!=Layout::n; ++J)
+	{
+		const Size k = Layout::pairs[J][0];
+		const Size l = Layout::pairs[J][1];
+		e[J] = (J < dim) ? eps(k,l) : eps(k,l) + eps(l,k);
+	}
+	
+	std::array<T, Layout::n> s;
+	detail::voigtProduct<Layout>(C.data(), e, s);
+	
+	Tensor<T, dim, dim> ret(T(0));
+	for (Size I=0; I!=Layout::n; ++I)
+	{
+		const Size i = Layout::pairs[I][0];
+		const Size j = Layout::pairs[I][1];
+		ret(i,j) = s[I];
+		ret(j,i) = s[I];
+	}
+	return ret;
+}
+
+template<std::floating_point T, unsigned int dim, Symmetry4 symmetry>
+typename SymmetricTensor4<T, dim, symmetry>::MandelVector doubleContraction(const SymmetricTensor4<T, dim, symmetry>& C, const typename SymmetricTensor4<T, dim, symmetry>::MandelVector& eps)
+{
+	using Layout = typename SymmetricTensor4<T, dim, symmetry>::Layout;
+	using Size   = typename Layout::Size;
+	
+	std::array<T, Layout::n> e;
+	for (Size J=0; J!=Layout::n; ++J) { e[J] = detail::mandelWeight<T,dim>(J)*eps[J]; }
+	
+	std::array<T, Layout::n> s;
+	detail::voigtProduct<Layout>(C.data(), e, s);
+	
+	typename SymmetricTensor4<T, dim, symmetry>::MandelVector ret(T(0));
+	for (Size I=0; I!=Layout::n; ++I) { ret[I] = detail::mandelWeight<T,dim>(I)*s[I]; }
+	return ret;
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_SYMMETRIC_TENSOR4_IMPL_HPP
@@ -4,14 +4,19 @@
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/Tensor/TensorUtils.hpp>
 #include <FSLinalg/misc/NestedInitializerList.hpp>
+#include <FSLinalg/Random.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
 
+#include <algorithm>
 #include <array>
 #include <numeric>
 
 namespace FSLinalg
 {
 
-template<typename T, unsigned int... dims> class Tensor;
+template<typename T, unsigned int... dims>               class Tensor;
+template<typename T, unsigned int... dims>               class TensorMap;
+template<typename T, unsigned int Nrows, unsigned Ncols> class MatrixMap;
 
 template<typename T, unsigned int... dims>
 struct TensorTraits< Tensor<T, dims...> >
@@ -25,12 +30,19 @@ struct TensorTraits< Tensor<T, dims...> >
 	static constexpr bool hasReadRandomAccess  = true;
 	static constexpr bool hasWriteRandomAccess = true;
 	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool hasStridedAccess     = true;
 	static constexpr bool causesAliasingIssues = false;
 	static constexpr bool isLeaf               = true;
 	
-	static constexpr Shape shape = Shape({dims...});
+	static constexpr Shape shape   = Shape({dims...});
+	static constexpr Shape strides = TensorUtils::getStrides(shape);
 };
 
+// tensors storing their entries contiguously in row-major order
+template<typename Expr>                      struct IsDenseTensor                            : BIC::Fixed<bool, false> {};
+template<typename T, unsigned int... dims> struct IsDenseTensor< Tensor<T, dims...> >    : BIC::Fixed<bool, true>  {};
+template<typename T, unsigned int... dims> struct IsDenseTensor< TensorMap<T, dims...> > : BIC::Fixed<bool, true>  {};
+
 template<typename T, unsigned int... dims> 
 class Tensor : public TensorBase< Tensor<T, dims...> >
 {
@@ -38,16 +50,15 @@ public:
 	using Self = Tensor<T, dims...>;
 	FSLINALG_DEFINE_TENSOR
 	
+	// maps of this tensor may reshape it, dense destinations are compared by storage
 	template<class Dst>
 	struct CanBeAlisaedTo : BIC::Fixed<bool,  
 		    IsTensor<Dst>::value 
-		and Base::shape == Dst::shape
+		and (std::ranges::equal(Base::shape, Dst::shape) or IsDenseTensor<Dst>::value)
 		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
 	
 	static constexpr bool isScalarComplex = IsComplexScalar<Scalar>::value;
 	
-	static constexpr Shape strides = TensorUtils::getStrides(shape);
-	
 	Tensor(const RealScalar& value = RealScalar(0))              requires(isScalarComplex) { for (Size i=0; i!=size; ++i) { m_data[i] = value; } }
 	Tensor(misc::NestedInitializerList<RealScalar, rank> values) requires(isScalarComplex) { initFromNestedInitializerList<RealScalar, rank>(values, m_data.data()); }
 	
@@ -72,19 +83,32 @@ public:
 	
 	void setZero() { m_data.fill(Scalar(0)); }
 	
+	const Scalar* data() const { return m_data.data(); }
+	      Scalar* data()       { return m_data.data(); }
+	
+	// views of the entries as a matrix, by default the leading dimensions flattened into rows (see MatrixMap)
+	template<unsigned int Nrows = size/shape[rank-1], unsigned int Ncols = shape[rank-1]> MatrixMap<const Scalar, Nrows, Ncols> asMatrix() const requires(Nrows*Ncols == size) { return MatrixMap<const Scalar, Nrows, Ncols>(data()); }
+	template<unsigned int Nrows = size/shape[rank-1], unsigned int Ncols = shape[rank-1]> MatrixMap<      Scalar, Nrows, Ncols> asMatrix()       requires(Nrows*Ncols == size) { return MatrixMap<      Scalar, Nrows, Ncols>(data()); }
+	
 	const_ReturnType getImpl(const Size i) const { return m_data[i]; }
 	      ReturnType getImpl(const Size i)       { return m_data[i]; }
 	      
 	template<std::integral... Idx> const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank) { return m_data[toFlatIndex(idx...)]; }
 	template<std::integral... Idx>       ReturnType getImpl(const Idx... idx)       requires(sizeof...(Idx) == rank) { return m_data[toFlatIndex(idx...)]; }
 	      
-	template<class Dst>           bool isAliasedToImpl(const TensorBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return std::addressof(dst.derived()) == this; }
+	template<class Dst>           bool isAliasedToImpl(const TensorBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) 
+	{ 
+		if constexpr (IsDenseTensor<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+		else                                     { return std::addressof(dst.derived()) == this;                          }
+	}
 	template<class Dst> constexpr bool isAliasedToImpl(const TensorBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
 	
 	static Tensor zero() { return Tensor(RealScalar(0)); }
 	static Tensor ones() { return Tensor(RealScalar(1)); }
 	
-	static Tensor random(const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1));
+	// uniform entries in [lb, ub), real and imaginary parts drawn independently for complex scalars
+	static Tensor random(RandomEngine& engine, const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1));
+	static Tensor random(const RealScalar& lb = RealScalar(-1), const RealScalar& ub = RealScalar(1)) { return random(RandomEngine::threadLocal(), lb, ub); }
 private:
 	template<std::integral... Idx, size_t... Is> Size toFlatIndexHelper(BIC::FixedIndices<Is...>, const Idx... idx) const requires(sizeof...(Idx) == rank and sizeof...(Is) == rank) { return ((idx*strides[Is]) + ...); } 
 	
@@ -5,6 +5,7 @@
 #include <FSLinalg/Scalar.hpp>
 #include <FSLinalg/misc/Logical.hpp>
 
+#include <array>
 #include <numeric>
 #include <concepts>
 
@@ -13,6 +14,8 @@ namespace FSLinalg
 
 template<class Derived> struct TensorTraits;
 
+// When hasStridedAccess is set, getImpl(i) accepts the offset sum(idx[d]*strides[d]) of the underlying storage. 
+// Flat random access is the particular case where strides are the row-major strides of shape.
 template<class Derived>
 class TensorBase : public CRTPBase<Derived>
 {
@@ -41,12 +44,16 @@ public:
 	static constexpr bool  hasReadRandomAccess  = DerivedTraits::hasReadRandomAccess;
 	static constexpr bool  hasWriteRandomAccess = DerivedTraits::hasWriteRandomAccess;
 	static constexpr bool  hasFlatRandomAccess  = DerivedTraits::hasFlatRandomAccess;
+	static constexpr bool  hasStridedAccess     = DerivedTraits::hasStridedAccess;
 	static constexpr bool  causesAliasingIssues = DerivedTraits::causesAliasingIssues;
 	static constexpr bool  isLeaf               = DerivedTraits::isLeaf;
 	static constexpr Shape shape                = DerivedTraits::shape;
+	static constexpr Shape strides              = DerivedTraits::strides;
 	static constexpr Size  rank                 = shape.size();
 	static constexpr Size  size                 = std::reduce(std::begin(shape), std::end(shape), Size(1), std::multiplies{});
 	
+	static_assert(hasStridedAccess or not hasFlatRandomAccess, "Flat random access is the particular case of strided access with row-major strides");
+	
 	constexpr Size getRank  ()             const { return rank;     }
 	constexpr Size getShape (const Size d) const { return shape[d]; }
 	constexpr Size getSize  ()             const { return size;     }
@@ -87,6 +94,28 @@ template<typename Expr> concept Tensor_concept         = IsTensor<Expr>::value;
 template<typename Expr> concept ReadableTensor_concept = IsTensor<Expr>::value and Expr::hasReadRandomAccess;
 template<typename Expr> concept WritableTensor_concept = IsTensor<Expr>::value and Expr::hasWriteRandomAccess;
 
+namespace detail
+{
+
+// Operands of Expr in the strided loop, each with its strides and read at its own storage offset: Expr itself when it
+// has strided access, the leaves below otherwise (a permuted tensor plus a plain one reads both leaves in one loop).
+// get() reads Expr at offsets[0, n).
+template<class Expr>
+struct StridedOperands
+{
+	using Size  = typename Expr::Size;
+	using Shape = typename Expr::Shape;
+	
+	static constexpr bool   value = Expr::hasStridedAccess;
+	static constexpr size_t n     = 1;
+	
+	static constexpr std::array<Shape, n> strides = {Expr::strides};
+	
+	static typename Expr::const_ReturnType get(const Expr& expr, const Size* offsets) { return expr.getImpl(offsets[0]); }
+};
+
+} // namespace detail
+
 #define FSLINALG_DEFINE_TENSOR \
 	using Base             = TensorBase<Self>; \
 	using Scalar           = typename Base::Scalar; \
@@ -102,17 +131,19 @@ template<typename Expr> concept WritableTensor_concept = IsTensor<Expr>::value a
 	using Base::hasReadRandomAccess;\
 	using Base::hasWriteRandomAccess;\
 	using Base::hasFlatRandomAccess;\
+	using Base::hasStridedAccess;\
 	using Base::causesAliasingIssues;\
 	using Base::isLeaf;\
 	using Base::rank;\
 	using Base::shape;\
+	using Base::strides;\
 	using Base::size;\
     \
 
 template<typename Lhs, typename Rhs> requires(Lhs::hasReadRandomAccess and Rhs::hasReadRandomAccess)  bool operator==(const FSLinalg::TensorBase<Lhs>& lhs, const FSLinalg::TensorBase<Rhs>& rhs);
 
-template<class Expr> requires(std::is_same<typename Expr::Scalar, bool>::value and Expr::hasReadRandomAccess) bool all(const TensorBase<Expr>& expr);
-template<class Expr> requires(std::is_same<typename Expr::Scalar, bool>::value and Expr::hasReadRandomAccess) bool any(const TensorBase<Expr>& expr);
+template<class Expr> requires(IsMask<typename Expr::Scalar>::value and Expr::hasReadRandomAccess) bool all(const TensorBase<Expr>& expr);
+template<class Expr> requires(IsMask<typename Expr::Scalar>::value and Expr::hasReadRandomAccess) bool any(const TensorBase<Expr>& expr);
    
 } // namespace FSLinalg
 
@@ -4,10 +4,55 @@
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/Tensor/Tensor.hpp>
 #include <FSLinalg/misc/NestedLoop.hpp>
+#include <FSLinalg/misc/StridedLoop.hpp>
+
+#include <algorithm>
 
 namespace FSLinalg
 {
 
+namespace detail
+{
+
+template<class Dst, class Src, class AssignOp>
+void tensorLoop(TensorBase<Dst>& dst, const TensorBase<Src>& src, const AssignOp& assignOp)
+{
+	using Size  = typename Src::Size;
+	using Shape = typename Src::Shape;
+	
+	if constexpr (Dst::hasFlatRandomAccess and Src::hasFlatRandomAccess)
+	{
+		for (Size i=0; i!=Src::size; ++i) { assignOp(dst[i], src[i]); }
+	}
+	else if constexpr (Dst::hasStridedAccess and StridedOperands<Src>::value)
+	{
+		using Operands = StridedOperands<Src>;
+	
+		constexpr auto allStrides = []() -> std::array<Shape, Operands::n + 1>
+		{
+			std::array<Shape, Operands::n + 1> ret{};
+			ret[0] = Dst::strides;
+			std::copy(Operands::strides.begin(), Operands::strides.end(), ret.begin() + 1);
+			return ret;
+		}();
+	
+		misc::stridedLoop<Src::shape, allStrides>([&](const Size dstOffset, const auto... srcOffsets) -> void
+		{
+			const std::array<Size, Operands::n> offsets = {srcOffsets...};
+			assignOp(dst.derived().getImpl(dstOffset), Operands::get(src.derived(), offsets.data()));
+		});
+	}
+	else
+	{
+		misc::nestedLoop(Src::shape, [&](const Shape& index) -> void
+		{
+			assignOp(dst(index), src(index));
+		});
+	}
+}
+
+} // namespace detail
+
 template<class Derived> template<typename Bool, typename Alpha, class Dst>
 void TensorBase<Derived>::assignTo(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
 {
@@ -15,35 +60,16 @@ void TensorBase<Derived>::assignTo(const Bool checkAliasing, const Alpha& alpha,
 	
 	if constexpr (hasReadRandomAccess)
 	{
+		const auto assignOp = [&](auto& y, const auto& x) -> void { y = alpha*x; };
+		
 		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
 		{
-			TensorFromShape<Scalar, shape> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*tmp[i]; }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) = alpha*tmp(index);
-				});
-			}
+			const TensorFromShape<Scalar, shape> tmp(*this);
+			detail::tensorLoop(dst, tmp, assignOp);
 		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] = alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) = alpha*CRTP::derived().getImpl(index);
-				});
-			}
+			detail::tensorLoop(dst, *this, assignOp);
 		}
 	}
 	else
@@ -59,35 +85,16 @@ void TensorBase<Derived>::increment(const Bool checkAliasing, const Alpha& alpha
 	
 	if constexpr (hasReadRandomAccess)
 	{
+		const auto assignOp = [&](auto& y, const auto& x) -> void { y += alpha*x; };
+		
 		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
 		{
-			TensorFromShape<Scalar, shape> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*tmp[i]; }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) += alpha*tmp(index);
-				});
-			}
+			const TensorFromShape<Scalar, shape> tmp(*this);
+			detail::tensorLoop(dst, tmp, assignOp);
 		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] += alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) += alpha*CRTP::derived().getImpl(index);
-				});
-			}
+			detail::tensorLoop(dst, *this, assignOp);
 		}
 	}
 	else
@@ -103,35 +110,16 @@ void TensorBase<Derived>::decrement(const Bool checkAliasing, const Alpha& alpha
 	
 	if constexpr (hasReadRandomAccess)
 	{
+		const auto assignOp = [&](auto& y, const auto& x) -> void { y -= alpha*x; };
+		
 		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
 		{
-			TensorFromShape<Scalar, shape> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*tmp[i]; }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) -= alpha*tmp(index);
-				});
-			}
+			const TensorFromShape<Scalar, shape> tmp(*this);
+			detail::tensorLoop(dst, tmp, assignOp);
 		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] -= alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) -= alpha*CRTP::derived().getImpl(index);
-				});
-			}
+			detail::tensorLoop(dst, *this, assignOp);
 		}
 	}
 	else
@@ -147,35 +135,16 @@ void TensorBase<Derived>::multiply(const Bool checkAliasing, const Alpha& alpha,
 	
 	if constexpr (hasReadRandomAccess)
 	{
+		const auto assignOp = [&](auto& y, const auto& x) -> void { y *= alpha*x; };
+		
 		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
 		{
-			TensorFromShape<Scalar, shape> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] *= alpha*tmp[i]; }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) *= alpha*tmp(index);
-				});
-			}
+			const TensorFromShape<Scalar, shape> tmp(*this);
+			detail::tensorLoop(dst, tmp, assignOp);
 		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] *= alpha*CRTP::derived().getImpl(i); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) *= alpha*CRTP::derived().getImpl(index);
-				});
-			}
+			detail::tensorLoop(dst, *this, assignOp);
 		}
 	}
 	else
@@ -191,35 +160,16 @@ void TensorBase<Derived>::divide(const Bool checkAliasing, const Alpha& alpha, T
 	
 	if constexpr (hasReadRandomAccess)
 	{
+		const auto assignOp = [&](auto& y, const auto& x) -> void { y /= (alpha*x); };
+		
 		if (checkAliasing and causesAliasingIssues and isAliasedTo(dst))
 		{
-			TensorFromShape<Scalar, shape> tmp(*this);
-			
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] /= (alpha*tmp[i]); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) /= (alpha*tmp(index));
-				});
-			}
+			const TensorFromShape<Scalar, shape> tmp(*this);
+			detail::tensorLoop(dst, tmp, assignOp);
 		}
 		else
 		{
-			if constexpr (hasFlatRandomAccess)
-			{
-				for (Size i=0; i!=getSize(); ++i) { dst[i] /= (alpha*CRTP::derived().getImpl(i)); }
-			}
-			else
-			{
-				misc::nestedLoop(shape, [&](const Shape& index) -> void
-				{
-					dst(index) /= (alpha*CRTP::derived().getImpl(index));
-				});
-			}
+			detail::tensorLoop(dst, *this, assignOp);
 		}
 	}
 	else
@@ -241,7 +191,7 @@ bool operator==(const FSLinalg::TensorBase<Lhs>& lhs, const FSLinalg::TensorBase
 	{
 		for (Size i=0; i!=Lhs::size; ++i)
 		{
-			areEquals = areEquals and (lhs[i] == rhs[i]);
+			areEquals = areEquals and all(lhs[i] == rhs[i]);
 		}
 
 	}
@@ -249,13 +199,13 @@ bool operator==(const FSLinalg::TensorBase<Lhs>& lhs, const FSLinalg::TensorBase
 	{
 		misc::nestedLoop(Lhs::shape, [&](const Shape& index) -> void
 		{
-			areEquals = areEquals and (lhs(index) == rhs(index));
+			areEquals = areEquals and all(lhs(index) == rhs(index));
 		});
 	}
 	return areEquals;
 }
 
-template<class Expr> requires(std::is_same<typename Expr::Scalar, bool>::value and Expr::hasReadRandomAccess) 
+template<class Expr> requires(IsMask<typename Expr::Scalar>::value and Expr::hasReadRandomAccess) 
 bool all(const TensorBase<Expr>& expr)
 {
 	using Size  = typename Expr::Size;
@@ -266,7 +216,7 @@ bool all(const TensorBase<Expr>& expr)
 	{
 		for (Size i=0; i!=Expr::size; ++i)
 		{
-			allTrue = allTrue and expr[i];
+			allTrue = allTrue and all(expr[i]);
 		}
 
 	}
@@ -274,13 +224,13 @@ bool all(const TensorBase<Expr>& expr)
 	{
 		misc::nestedLoop(Expr::shape, [&](const Shape& index) -> void
 		{
-			allTrue = allTrue and expr(index);
+			allTrue = allTrue and all(expr(index));
 		});
 	}
 	return allTrue;
 }
 
-template<class Expr> requires(std::is_same<typename Expr::Scalar, bool>::value and Expr::hasReadRandomAccess) 
+template<class Expr> requires(IsMask<typename Expr::Scalar>::value and Expr::hasReadRandomAccess) 
 bool any(const TensorBase<Expr>& expr)
 {
 	using Size  = typename Expr::Size;
@@ -291,7 +241,7 @@ bool any(const TensorBase<Expr>& expr)
 	{
 		for (Size i=0; i!=Expr::size; ++i)
 		{
-			anyTrue = anyTrue or expr[i];
+			anyTrue = anyTrue or any(expr[i]);
 		}
 
 	}
@@ -299,7 +249,7 @@ bool any(const TensorBase<Expr>& expr)
 	{
 		misc::nestedLoop(Expr::shape, [&](const Shape& index) -> void
 		{
-			anyTrue = anyTrue or expr(index);
+			anyTrue = anyTrue or any(expr(index));
 		});
 	}
 	return anyTrue;
@@ -4,12 +4,18 @@
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/Tensor/TensorBase.hpp>
 #include <FSLinalg/misc/BinaryOp.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+
+#include <algorithm>
 
 namespace FSLinalg
 {
 
 template<class Lhs, class Rhs, class Op> class TensorBinaryOp;
 
+template<class Expr>           struct IsTensorProduct                                            : BIC::Fixed<bool, false> {};
+template<class Lhs, class Rhs> struct IsTensorProduct< TensorBinaryOp<Lhs, Rhs, BinaryOp::Mul> > : BIC::Fixed<bool, IsScalar<typename Lhs::Scalar>::value and IsScalar<typename Rhs::Scalar>::value> {};
+
 template<class Lhs, class Rhs, class Op> 
 struct TensorTraits< TensorBinaryOp<Lhs, Rhs, Op> >
 {		
@@ -25,10 +31,12 @@ struct TensorTraits< TensorBinaryOp<Lhs, Rhs, Op> >
 	static constexpr bool hasReadRandomAccess  = Lhs::hasReadRandomAccess and Rhs::hasReadRandomAccess;
 	static constexpr bool hasWriteRandomAccess = false;
 	static constexpr bool hasFlatRandomAccess  = Lhs::hasFlatRandomAccess and Rhs::hasFlatRandomAccess;
+	static constexpr bool hasStridedAccess     = Lhs::hasStridedAccess and Rhs::hasStridedAccess and Lhs::strides == Rhs::strides;
 	static constexpr bool causesAliasingIssues = Lhs::causesAliasingIssues or Rhs::causesAliasingIssues;
 	static constexpr bool isLeaf               = false;
 	
-	static constexpr Shape shape = Lhs::shape;
+	static constexpr Shape shape   = Lhs::shape;
+	static constexpr Shape strides = Lhs::strides;
 };
 
 template<class Lhs, class Rhs, class Op> 
@@ -43,11 +51,18 @@ public:
 	static constexpr bool isMul = std::is_same<Op, BinaryOp::Mul>::value;
 	static constexpr bool isDiv = std::is_same<Op, BinaryOp::Div>::value;
 	
+	// a*b + c and c + a*b are evaluated with a single multiply-add
+	static constexpr bool isLhsMultiplyAdd = isSum and IsTensorProduct<Lhs>::value and IsScalar<typename Rhs::Scalar>::value;
+	static constexpr bool isRhsMultiplyAdd = isSum and IsTensorProduct<Rhs>::value and IsScalar<typename Lhs::Scalar>::value and not isLhsMultiplyAdd;
+	
+	template<class, class, class> friend class TensorBinaryOp;
+	template<class>               friend struct detail::StridedOperands;
+	
 	TensorBinaryOp(const TensorBase<Lhs>& lhs, const TensorBase<Rhs>& rhs) : m_lhs(lhs.derived()), m_rhs(rhs.derived()) {}
 	
 	template<std::integral... Idx> 
-	const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank and hasReadRandomAccess)  { return m_op(m_lhs(idx...), m_rhs(idx...)); }
-	const_ReturnType getImpl(const Size i)     const requires(hasReadRandomAccess  and hasFlatRandomAccess)    { return m_op(m_lhs[i], m_rhs[i]);           }
+	const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank and hasReadRandomAccess);
+	const_ReturnType getImpl(const Size i)     const requires(hasReadRandomAccess and hasStridedAccess);
 	
 	template<class Dst> bool isAliasedToImpl(const TensorBase<Dst>& other) const { return m_lhs.isAliasedToImpl(other) or m_rhs.isAliasedToImpl(other); }
 	
@@ -71,6 +86,55 @@ private:
 	Op                                               m_op;
 };
 
+namespace detail
+{
+
+// operands with different strides are read at their own offsets, the operands of Lhs first
+template<class Lhs, class Rhs, class Op>
+struct StridedOperands< TensorBinaryOp<Lhs, Rhs, Op> >
+{
+	using Node  = TensorBinaryOp<Lhs, Rhs, Op>;
+	using L     = StridedOperands<Lhs>;
+	using R     = StridedOperands<Rhs>;
+	using Size  = typename Node::Size;
+	using Shape = typename Node::Shape;
+	
+	static constexpr bool   value = Node::hasStridedAccess or (L::value and R::value);
+	static constexpr size_t n     = Node::hasStridedAccess ? 1 : L::n + R::n;
+	
+	static constexpr std::array<Shape, n> strides = []() -> std::array<Shape, n>
+	{
+		if constexpr (Node::hasStridedAccess) { return {Node::strides}; }
+		else
+		{
+			std::array<Shape, n> ret{};
+			std::copy(L::strides.begin(), L::strides.end(), ret.begin());
+			std::copy(R::strides.begin(), R::strides.end(), ret.begin() + L::n);
+			return ret;
+		}
+	}();
+	
+	static typename Node::Scalar get(const Node& node, const Size* offsets)
+	{
+		if      constexpr (Node::hasStridedAccess) { return node.getImpl(offsets[0]);                                                   }
+		else if constexpr (Node::isLhsMultiplyAdd) { return L::multiplyAdd(node.m_lhs, offsets, R::get(node.m_rhs, offsets + L::n));   }
+		else if constexpr (Node::isRhsMultiplyAdd) { return R::multiplyAdd(node.m_rhs, offsets + L::n, L::get(node.m_lhs, offsets));   }
+		else                                       { return node.m_op(L::get(node.m_lhs, offsets), R::get(node.m_rhs, offsets + L::n)); }
+	}
+	
+	// a*b + c for a product node, so that sums keep their multiply-add
+	template<typename C>
+	static auto multiplyAdd(const Node& node, const Size* offsets, const C& c) requires(Node::isMul)
+	{
+		constexpr BasicLinalg::MultiplyAdd<false, false> madd;
+	
+		if constexpr (Node::hasStridedAccess) { return madd(node.m_lhs.getImpl(offsets[0]), node.m_rhs.getImpl(offsets[0]), c); }
+		else                                  { return madd(L::get(node.m_lhs, offsets), R::get(node.m_rhs, offsets + L::n), c); }
+	}
+};
+
+} // namespace detail
+
 template<class Lhs, class Rhs> 
 TensorBinaryOp<Lhs,Rhs,BinaryOp::Add> operator+(const TensorBase<Lhs>& lhs, const TensorBase<Rhs>& rhs) { return TensorBinaryOp<Lhs,Rhs,BinaryOp::Add>(lhs, rhs); }
 
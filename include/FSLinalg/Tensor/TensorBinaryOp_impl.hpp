@@ -7,6 +7,26 @@
 namespace FSLinalg
 {
 
+template<class Lhs, class Rhs, class BinaryOp> template<std::integral... Idx> 
+auto TensorBinaryOp<Lhs, Rhs, BinaryOp>::getImpl(const Idx... idx) const -> const_ReturnType requires(sizeof...(Idx) == rank and hasReadRandomAccess)
+{
+	constexpr BasicLinalg::MultiplyAdd<false, false> madd;
+	
+	if      constexpr (isLhsMultiplyAdd) { return madd(m_lhs.m_lhs(idx...), m_lhs.m_rhs(idx...), m_rhs(idx...)); }
+	else if constexpr (isRhsMultiplyAdd) { return madd(m_rhs.m_lhs(idx...), m_rhs.m_rhs(idx...), m_lhs(idx...)); }
+	else                                 { return m_op(m_lhs(idx...), m_rhs(idx...));                            }
+}
+
+template<class Lhs, class Rhs, class BinaryOp>
+auto TensorBinaryOp<Lhs, Rhs, BinaryOp>::getImpl(const Size i) const -> const_ReturnType requires(hasReadRandomAccess and hasStridedAccess)
+{
+	constexpr BasicLinalg::MultiplyAdd<false, false> madd;
+	
+	if      constexpr (isLhsMultiplyAdd) { return madd(m_lhs.m_lhs.getImpl(i), m_lhs.m_rhs.getImpl(i), m_rhs.getImpl(i)); }
+	else if constexpr (isRhsMultiplyAdd) { return madd(m_rhs.m_lhs.getImpl(i), m_rhs.m_rhs.getImpl(i), m_lhs.getImpl(i)); }
+	else                                 { return m_op(m_lhs.getImpl(i), m_rhs.getImpl(i));                                }
+}
+
 template<class Lhs, class Rhs, class BinaryOp> template<typename Bool, typename Alpha, class Dst>
 void TensorBinaryOp<Lhs, Rhs, BinaryOp>::assignToImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value)
 {	
@@ -0,0 +1,98 @@
+#ifndef FSLINALG_TENSOR_MAP_HPP
+#define FSLINALG_TENSOR_MAP_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorUtils.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
+
+#include <algorithm>
+#include <array>
+#include <type_traits>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int... dims>
+struct TensorTraits< TensorMap<T, dims...> >
+{
+	static_assert(sizeof...(dims) > 0);
+	
+	using Scalar = std::remove_const_t<T>;
+	using Size   = unsigned int;
+	using Shape  = std::array<Size, sizeof...(dims)>;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = not std::is_const<T>::value;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool hasStridedAccess     = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = true;
+	
+	static constexpr Shape shape   = Shape({dims...});
+	static constexpr Shape strides = TensorUtils::getStrides(shape);
+};
+
+/*
+ * Tensor over row-major scalars owned elsewhere (a Matrix, see Matrix::asTensor()), read-only for a const T. A map is a
+ * leaf held by reference in expressions, which must not outlive it. Assignments write through the map.
+ */
+template<typename T, unsigned int... dims>
+class TensorMap : public TensorBase< TensorMap<T, dims...> >
+{
+public:
+	using Self = TensorMap<T, dims...>;
+	FSLINALG_DEFINE_TENSOR
+	
+	template<class Dst>
+	struct CanBeAlisaedTo : BIC::Fixed<bool,
+		    IsDenseTensor<Dst>::value
+		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
+	
+	static constexpr bool isScalarComplex = IsComplexScalar<Scalar>::value;
+	
+	explicit TensorMap(T* data) : m_data(data) {}
+	
+	TensorMap(const TensorMap& other) = default;
+	
+	TensorMap& operator=(const TensorMap& other) requires(hasWriteRandomAccess) { other.assignTo(BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	
+	template<class Expr> TensorMap& operator= (const TensorBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.assignTo  (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> TensorMap& operator+=(const TensorBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.increment (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> TensorMap& operator-=(const TensorBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.decrement (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> TensorMap& operator*=(const TensorBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.multiply  (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	template<class Expr> TensorMap& operator/=(const TensorBase<Expr>& expr) requires(IsConstructibleFrom<Expr>::value) { expr.divide    (BIC::fixed<bool, true>, BIC::fixed<RealScalar, RealScalar(1)>, *this); return *this; }
+	
+	TensorMap& operator*=(const RealScalar& alpha) requires(hasWriteRandomAccess and isScalarComplex) { for (Size i=0; i!=size; ++i) { m_data[i] *= alpha; } return *this; }
+	TensorMap& operator/=(const RealScalar& alpha) requires(hasWriteRandomAccess and isScalarComplex) { for (Size i=0; i!=size; ++i) { m_data[i] /= alpha; } return *this; }
+	
+	TensorMap& operator*=(const Scalar& alpha) requires(hasWriteRandomAccess) { for (Size i=0; i!=size; ++i) { m_data[i] *= alpha; } return *this; }
+	TensorMap& operator/=(const Scalar& alpha) requires(hasWriteRandomAccess) { for (Size i=0; i!=size; ++i) { m_data[i] /= alpha; } return *this; }
+	
+	void setZero() requires(hasWriteRandomAccess) { std::fill_n(m_data, size, Scalar(0)); }
+	
+	const Scalar* data() const { return m_data; }
+	      T*      data()       { return m_data; }
+	
+	template<unsigned int Nrows = size/shape[rank-1], unsigned int Ncols = shape[rank-1]> MatrixMap<const Scalar, Nrows, Ncols> asMatrix() const requires(Nrows*Ncols == size) { return MatrixMap<const Scalar, Nrows, Ncols>(m_data); }
+	template<unsigned int Nrows = size/shape[rank-1], unsigned int Ncols = shape[rank-1]> MatrixMap<      T,      Nrows, Ncols> asMatrix()       requires(Nrows*Ncols == size) { return MatrixMap<      T,      Nrows, Ncols>(m_data); }
+	
+	const_ReturnType getImpl(const Size i) const                               { return m_data[i]; }
+	      ReturnType getImpl(const Size i)       requires(hasWriteRandomAccess) { return m_data[i]; }
+	
+	template<std::integral... Idx> const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank)                          { return m_data[toFlatIndex(idx...)]; }
+	template<std::integral... Idx>       ReturnType getImpl(const Idx... idx)       requires(sizeof...(Idx) == rank and hasWriteRandomAccess) { return m_data[toFlatIndex(idx...)]; }
+	
+	template<class Dst>           bool isAliasedToImpl(const TensorBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+	template<class Dst> constexpr bool isAliasedToImpl(const TensorBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
+private:
+	template<std::integral... Idx, size_t... Is> Size toFlatIndexHelper(BIC::FixedIndices<Is...>, const Idx... idx) const requires(sizeof...(Idx) == rank and sizeof...(Is) == rank) { return ((idx*strides[Is]) + ...); }
+	
+	template<std::integral... Idx> Size toFlatIndex(const Idx... idx) const requires(sizeof...(Idx) == rank) { return toFlatIndexHelper(BIC::indexSeq<0, rank>, idx...); }
+	
+	T* m_data;
+};
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_MAP_HPP
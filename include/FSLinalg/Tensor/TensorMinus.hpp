@@ -0,0 +1,90 @@
+#ifndef FSLINALG_TENSOR_MINUS_HPP
+#define FSLINALG_TENSOR_MINUS_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+
+namespace FSLinalg
+{
+
+template<class Expr> class TensorMinus;
+
+template<class Expr> 
+struct TensorTraits< TensorMinus<Expr> >
+{
+	static_assert(IsTensor<Expr>::value, "Expr must be a Tensor");
+	
+	using Scalar = typename Expr::Scalar;
+	using Size   = typename Expr::Size;
+	using Shape  = typename Expr::Shape;
+	
+	static constexpr bool hasReadRandomAccess  = Expr::hasReadRandomAccess;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = Expr::hasFlatRandomAccess;
+	static constexpr bool hasStridedAccess     = Expr::hasStridedAccess;
+	static constexpr bool causesAliasingIssues = Expr::causesAliasingIssues;
+	static constexpr bool isLeaf               = false;
+	
+	static constexpr Shape shape   = Expr::shape;
+	static constexpr Shape strides = Expr::strides;
+};
+
+template<class Expr> 
+class TensorMinus : public TensorBase< TensorMinus<Expr> >
+{
+public:
+	using Self = TensorMinus<Expr>;
+	FSLINALG_DEFINE_TENSOR
+	
+	TensorMinus(const TensorBase<Expr>& expr) : m_expr(expr.derived()) {}
+	
+	template<std::integral... Idx> 
+	const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank and hasReadRandomAccess) { return -m_expr(idx...); }
+	const_ReturnType getImpl(const Size i)     const requires(hasReadRandomAccess and hasStridedAccess)      { return -m_expr.getImpl(i); }
+	
+	template<class Dst> bool isAliasedToImpl(const TensorBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
+	
+	template<class> friend struct detail::StridedOperands;
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void assignToImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { m_expr.assignTo(checkAliasing, -alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void incrementImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { m_expr.decrement(checkAliasing, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void decrementImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { m_expr.increment(checkAliasing, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void multiplyImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { m_expr.multiply(checkAliasing, -alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void divideImpl(const Bool checkAliasing, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { m_expr.divide(checkAliasing, -alpha, dst); }
+private:
+	std::conditional_t<Expr::isLeaf, const Expr&, Expr> m_expr;
+};
+
+namespace detail
+{
+
+template<class Expr>
+struct StridedOperands< TensorMinus<Expr> >
+{
+	using Node     = TensorMinus<Expr>;
+	using Operands = StridedOperands<Expr>;
+	using Size     = typename Node::Size;
+	
+	static constexpr bool   value   = Operands::value;
+	static constexpr size_t n       = Operands::n;
+	static constexpr auto   strides = Operands::strides;
+	
+	static typename Node::Scalar get(const Node& node, const Size* offsets) { return -Operands::get(node.m_expr, offsets); }
+};
+
+} // namespace detail
+
+template<class Expr> 
+TensorMinus<Expr> operator-(const TensorBase<Expr>& expr) { return TensorMinus<Expr>(expr); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_MINUS_HPP
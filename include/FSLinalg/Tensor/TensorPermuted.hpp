@@ -0,0 +1,88 @@
+#ifndef FSLINALG_TENSOR_PERMUTED_HPP
+#define FSLINALG_TENSOR_PERMUTED_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+#include <FSLinalg/Tensor/TensorUtils.hpp>
+
+namespace FSLinalg
+{
+
+template<class Expr, unsigned int... axes> class TensorPermuted;
+
+template<class Expr, unsigned int... axes> 
+struct TensorTraits< TensorPermuted<Expr, axes...> >
+{
+	static_assert(IsTensor<Expr>::value, "Expr must be a Tensor");
+	static_assert(Expr::hasReadRandomAccess, "Expr must have read random access");
+	static_assert(sizeof...(axes) == Expr::rank, "One axis per dimension is required");
+	static_assert(TensorUtils::isPermutation(std::array{axes...}), "Axes must be a permutation of the dimensions of Expr");
+	
+	using Scalar = typename Expr::Scalar;
+	using Size   = typename Expr::Size;
+	using Shape  = typename Expr::Shape;
+	
+	static constexpr bool isIdentity = TensorUtils::isIdentity(std::array{axes...});
+	
+	static constexpr Shape shape   = Shape({Expr::shape[axes]...});
+	static constexpr Shape strides = Shape({Expr::strides[axes]...});
+	
+	static constexpr bool hasReadRandomAccess  = Expr::hasReadRandomAccess;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = Expr::hasFlatRandomAccess and Expr::hasStridedAccess and strides == TensorUtils::getStrides(shape);
+	static constexpr bool hasStridedAccess     = Expr::hasStridedAccess;
+	static constexpr bool causesAliasingIssues = Expr::causesAliasingIssues or not isIdentity;
+	static constexpr bool isLeaf               = false;
+};
+
+template<class Expr, unsigned int... axes> 
+class TensorPermuted : public TensorBase< TensorPermuted<Expr, axes...> >
+{
+public:
+	using Self = TensorPermuted<Expr, axes...>;
+	FSLINALG_DEFINE_TENSOR
+	
+	TensorPermuted(const TensorBase<Expr>& expr) : m_expr(expr.derived()) {}
+	
+	template<std::integral... Idx> 
+	const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank and hasReadRandomAccess) { Shape index; ((index[axes] = Size(idx)), ...); return m_expr(index); }
+	const_ReturnType getImpl(const Size i)     const requires(hasReadRandomAccess and hasStridedAccess)      { return m_expr.getImpl(i); }
+	
+	template<class Dst> bool isAliasedToImpl(const TensorBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
+	
+	template<class> friend struct detail::StridedOperands;
+private:
+	std::conditional_t<Expr::isLeaf, const Expr&, Expr> m_expr;
+};
+
+namespace detail
+{
+
+template<class Expr, unsigned int... axes>
+struct StridedOperands< TensorPermuted<Expr, axes...> >
+{
+	using Node     = TensorPermuted<Expr, axes...>;
+	using Operands = StridedOperands<Expr>;
+	using Size     = typename Node::Size;
+	using Shape    = typename Node::Shape;
+	
+	static constexpr bool   value = Operands::value;
+	static constexpr size_t n     = Operands::n;
+	
+	static constexpr std::array<Shape, n> strides = []() -> std::array<Shape, n>
+	{
+		std::array<Shape, n> ret{};
+		for (size_t k=0; k!=n; ++k) { ret[k] = Shape({Operands::strides[k][axes]...}); }
+		return ret;
+	}();
+	
+	static typename Node::const_ReturnType get(const Node& node, const Size* offsets) { return Operands::get(node.m_expr, offsets); }
+};
+
+} // namespace detail
+
+template<unsigned int... axes, class Expr> 
+TensorPermuted<Expr, axes...> permute(const TensorBase<Expr>& expr) { return TensorPermuted<Expr, axes...>(expr); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_PERMUTED_HPP
@@ -0,0 +1,90 @@
+#ifndef FSLINALG_TENSOR_REDUCTION_HPP
+#define FSLINALG_TENSOR_REDUCTION_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorUtils.hpp>
+#include <FSLinalg/misc/ReductionOp.hpp>
+
+namespace FSLinalg
+{
+
+template<class Op, class Expr, unsigned int... axes> class TensorReduction;
+
+template<class Op, class Expr, unsigned int... axes>
+struct TensorTraits< TensorReduction<Op, Expr, axes...> >
+{
+	static_assert(IsTensor<Expr>::value, "Expr must be a Tensor");
+	static_assert(sizeof...(axes) > 0 and sizeof...(axes) < Expr::rank, "Reductions over every axis return a scalar");
+	static_assert(TensorUtils::areDistinctAxes(std::array{axes...}, Expr::rank), "Axes must be distinct dimensions of Expr");
+	
+	using Scalar = typename Op::template Result<typename Expr::Scalar>;
+	using Size   = typename Expr::Size;
+	using Shape  = std::array<Size, Expr::rank - sizeof...(axes)>;
+	
+	static constexpr std::array<bool, Expr::rank> isReduced = TensorUtils::axesMask<Expr::rank>(std::array{axes...});
+	
+	// number of dimensions of Expr up to the last kept one
+	static constexpr size_t nOuter = []() -> size_t { size_t n = Expr::rank; while (isReduced[n-1]) { --n; } return n; }();
+	
+	static constexpr bool hasReadRandomAccess  = false;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = false;
+	static constexpr bool hasStridedAccess     = false;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false;
+	
+	static constexpr Shape shape   = TensorUtils::removeAxes<Expr::rank - sizeof...(axes)>(Expr::shape, isReduced);
+	static constexpr Shape strides = TensorUtils::getStrides(shape);
+};
+
+/*
+ * Reduction of Expr over the given axes with Op (see ReductionOp), the other axes giving the result shape.
+ * The node is lazy: it is evaluated when assigned, in one pass over Expr in storage order. Kept trailing axes make the
+ * innermost loop an elementwise update of contiguous results; reduced trailing axes are reduced with independent
+ * accumulators (see BasicLinalg::Reduction) for each result.
+ */
+template<class Op, class Expr, unsigned int... axes>
+class TensorReduction : public TensorBase< TensorReduction<Op, Expr, axes...> >
+{
+public:
+	using Self = TensorReduction<Op, Expr, axes...>;
+	FSLINALG_DEFINE_TENSOR
+	
+	TensorReduction(const TensorBase<Expr>& expr) : m_expr(expr.derived()) {}
+	
+	template<class Dst> bool isAliasedToImpl(const TensorBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
+	
+	// the results are computed in a temporary, so that dst may alias Expr
+	template<typename Bool, typename Alpha, class Dst>
+	void assignToImpl(const Bool, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { eval().assignTo(BIC::fixed<bool, false>, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void incrementImpl(const Bool, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { eval().increment(BIC::fixed<bool, false>, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void decrementImpl(const Bool, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { eval().decrement(BIC::fixed<bool, false>, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void multiplyImpl(const Bool, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { eval().multiply(BIC::fixed<bool, false>, alpha, dst); }
+	
+	template<typename Bool, typename Alpha, class Dst>
+	void divideImpl(const Bool, const Alpha& alpha, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Alpha>::value) { eval().divide(BIC::fixed<bool, false>, alpha, dst); }
+	
+	TensorFromShape<Scalar, shape> eval() const;
+private:
+	std::conditional_t<Expr::isLeaf, const Expr&, Expr> m_expr;
+};
+
+// reduction over axes, or over every axis (no axes given or all of them) which returns a scalar
+template<class Op, unsigned int... axes, class Expr>
+auto reduce(const TensorBase<Expr>& expr);
+
+template<unsigned int... axes, class Expr> auto sum (const TensorBase<Expr>& expr) { return reduce<ReductionOp::Sum,  axes...>(expr); }
+template<unsigned int... axes, class Expr> auto mean(const TensorBase<Expr>& expr) { return reduce<ReductionOp::Mean, axes...>(expr); }
+template<unsigned int... axes, class Expr> auto max (const TensorBase<Expr>& expr) { return reduce<ReductionOp::Max,  axes...>(expr); }
+template<unsigned int... axes, class Expr> auto norm(const TensorBase<Expr>& expr) { return reduce<ReductionOp::Norm, axes...>(expr); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_REDUCTION_HPP
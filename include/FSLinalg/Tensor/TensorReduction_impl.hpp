@@ -0,0 +1,166 @@
+#ifndef FSLINALG_TENSOR_REDUCTION_IMPL_HPP
+#define FSLINALG_TENSOR_REDUCTION_IMPL_HPP
+
+#include <FSLinalg/Tensor/TensorReduction.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/BasicLinalg/Reduction.hpp>
+#include <FSLinalg/misc/NestedLoop.hpp>
+#include <FSLinalg/misc/StridedLoop.hpp>
+
+namespace FSLinalg
+{
+
+namespace detail
+{
+
+/*
+ * Split of the dimensions of a reduced operand: the nOuter first dimensions, up to the last kept one, and the trailing
+ * reduced dimensions reduced innermost, whose offsets are a multiple of the last stride when they are contiguous.
+ */
+template<std::array shape, std::array strides, size_t nOuter>
+struct ReductionLayout
+{
+	using Size = typename decltype(shape)::value_type;
+	
+	static constexpr size_t rank = shape.size();
+	
+	static constexpr Size   nInner = []() -> Size { Size n = 1; for (size_t d=nOuter; d!=rank; ++d) { n *= shape[d]; } return n; }();
+	
+	using OuterShape = std::array<Size, nOuter>;
+	
+	static constexpr OuterShape head(const std::array<Size, rank>& values) { OuterShape ret{}; for (size_t d=0; d!=nOuter; ++d) { ret[d] = values[d]; } return ret; }
+	
+	static constexpr OuterShape outerShape   = head(shape);
+	static constexpr OuterShape outerStrides = head(strides);
+	
+	static constexpr Size innerStep = strides[rank-1];
+	
+	static constexpr bool isInnerContiguous = []() -> bool
+	{
+		Size step = innerStep;
+		for (size_t d=rank; d-- != nOuter; )
+		{
+			if (strides[d] != step) { return false; }
+			step *= shape[d];
+		}
+		return true;
+	}();
+	
+	using InnerOffsets = std::array<Size, isInnerContiguous ? 1 : nInner>;
+	
+	static constexpr InnerOffsets innerOffsets = []() -> InnerOffsets
+	{
+		InnerOffsets ret{};
+		for (Size k=0; k!=ret.size() and not isInnerContiguous; ++k)
+		{
+			Size rem = k;
+			for (size_t d=rank; d-- != nOuter; ) { ret[k] += (rem % shape[d])*strides[d]; rem /= shape[d]; }
+		}
+		return ret;
+	}();
+	
+	static constexpr Size innerOffset(const Size k) 
+	{ 
+		if constexpr (isInnerContiguous) { return k*innerStep;       }
+		else                             { return innerOffsets[k];   }
+	}
+};
+
+// reduction over every entry of expr
+template<class Op, class Expr>
+typename Op::template Result<typename Expr::Scalar> reduceAll(const Expr& expr)
+{
+	using InScalar = typename Expr::Scalar;
+	using Acc      = typename Op::template Result<InScalar>;
+	using Size     = typename Expr::Size;
+	using Operand  = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, TensorFromShape<InScalar, Expr::shape> >;
+	
+	const Operand x(expr);
+	
+	Acc acc = Op::template identity<InScalar>();
+	if constexpr (std::remove_cvref_t<Operand>::hasFlatRandomAccess)
+	{
+		acc = BasicLinalg::Reduction<Expr::size>::run([&](Acc& a, const Size i) -> void { a = Op::accumulate(a, x[i]); }, acc, [](const Acc& a, const Acc& b) -> Acc { return Op::combine(a, b); });
+	}
+	else
+	{
+		misc::nestedLoop(Expr::shape, [&](const typename Expr::Shape& index) -> void { acc = Op::accumulate(acc, x(index)); });
+	}
+	return Op::finalize(acc, Expr::size);
+}
+
+} // namespace detail
+
+template<class Op, class Expr, unsigned int... axes>
+auto TensorReduction<Op, Expr, axes...>::eval() const -> TensorFromShape<Scalar, shape>
+{
+	using Traits   = TensorTraits<Self>;
+	using InScalar = typename Expr::Scalar;
+	using InShape  = typename Expr::Shape;
+	using Operand  = std::conditional_t<Expr::hasReadRandomAccess, const Expr&, TensorFromShape<InScalar, Expr::shape> >;
+	using Result   = TensorFromShape<Scalar, shape>;
+	
+	constexpr Size count = Expr::size/size;
+	
+	const Operand x(m_expr);
+	
+	Result acc(Op::template identity<InScalar>());
+	
+	if constexpr (std::remove_cvref_t<Operand>::hasStridedAccess)
+	{
+		constexpr InShape inStrides  = std::remove_cvref_t<Operand>::strides;
+		constexpr InShape outStrides = TensorUtils::insertZeros(Result::strides, Traits::isReduced);
+	
+		using In  = detail::ReductionLayout<Expr::shape, inStrides,  Traits::nOuter>;
+		using Out = detail::ReductionLayout<Expr::shape, outStrides, Traits::nOuter>;
+	
+		if constexpr (In::nInner == 1)
+		{
+			// the innermost loop runs over kept axes: elementwise update of contiguous results
+			misc::stridedLoop<Expr::shape, std::array<InShape, 2>{outStrides, inStrides}>([&](const Size o, const Size i) -> void
+			{
+				acc[o] = Op::accumulate(acc[o], x.getImpl(i));
+			});
+		}
+		else
+		{
+			using OuterShape = typename In::OuterShape;
+	
+			misc::stridedLoop<In::outerShape, std::array<OuterShape, 2>{Out::outerStrides, In::outerStrides}>([&](const Size o, const Size i) -> void
+			{
+				const Scalar partial = BasicLinalg::Reduction<In::nInner>::run([&](Scalar& a, const Size k) -> void 
+				{ 
+					a = Op::accumulate(a, x.getImpl(i + In::innerOffset(k))); 
+				}, 
+				Scalar(Op::template identity<InScalar>()), [](const Scalar& a, const Scalar& b) -> Scalar { return Op::combine(a, b); });
+	
+				acc[o] = Op::combine(acc[o], partial);
+			});
+		}
+	}
+	else
+	{
+		misc::nestedLoop(Expr::shape, [&](const InShape& index) -> void
+		{
+			const Shape o = TensorUtils::removeAxes<rank>(index, Traits::isReduced);
+			acc(o) = Op::accumulate(acc(o), x(index));
+		});
+	}
+	
+	for (Size i=0; i!=size; ++i) { acc[i] = Op::finalize(acc[i], count); }
+	
+	return acc;
+}
+
+template<class Op, unsigned int... axes, class Expr>
+auto reduce(const TensorBase<Expr>& expr)
+{
+	static_assert(TensorUtils::areDistinctAxes(std::array<unsigned int, sizeof...(axes)>{axes...}, Expr::rank), "Axes must be distinct dimensions of Expr");
+	
+	if constexpr (sizeof...(axes) == 0 or sizeof...(axes) == Expr::rank) { return detail::reduceAll<Op>(expr.derived()); }
+	else                                                                 { return TensorReduction<Op, Expr, axes...>(expr); }
+}
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_REDUCTION_IMPL_HPP
@@ -0,0 +1,97 @@
+#ifndef FSLINALG_TENSOR_SCALE_HPP
+#define FSLINALG_TENSOR_SCALE_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+
+namespace FSLinalg
+{
+
+template<typename Alpha, class Expr> class TensorScale;
+
+template<typename Alpha, class Expr> 
+struct TensorTraits< TensorScale<Alpha,Expr> >
+{
+	static_assert(IsScalar<Alpha>::value and IsTensor<Expr>::value, "Alpha must be a Scalar and Expr must be a Tensor");
+	
+	using Scalar = decltype(std::declval<Alpha>() * std::declval<typename Expr::Scalar>());
+	using Size   = typename Expr::Size;
+	using Shape  = typename Expr::Shape;
+	
+	static constexpr bool hasReadRandomAccess  = Expr::hasReadRandomAccess;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = Expr::hasFlatRandomAccess;
+	static constexpr bool hasStridedAccess     = Expr::hasStridedAccess;
+	static constexpr bool causesAliasingIssues = Expr::causesAliasingIssues;
+	static constexpr bool isLeaf               = false;
+	
+	static constexpr Shape shape   = Expr::shape;
+	static constexpr Shape strides = Expr::strides;
+};
+
+template<typename Alpha, class Expr> 
+class TensorScale : public TensorBase< TensorScale<Alpha,Expr> >
+{
+public:
+	using Self = TensorScale<Alpha,Expr>;
+	FSLINALG_DEFINE_TENSOR
+	
+	TensorScale(const Alpha& alpha, const TensorBase<Expr>& expr) : m_alpha(alpha), m_expr(expr.derived()) { }
+	
+	template<std::integral... Idx> 
+	const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank and hasReadRandomAccess) { return m_alpha*m_expr(idx...); }
+	const_ReturnType getImpl(const Size i)     const requires(hasReadRandomAccess and hasStridedAccess)      { return m_alpha*m_expr.getImpl(i); }
+	
+	template<class Dst> bool isAliasedToImpl(const TensorBase<Dst>& other) const { return m_expr.isAliasedToImpl(other); }
+	
+	template<class> friend struct detail::StridedOperands;
+	
+	template<typename Bool, typename Beta, class Dst>
+	void assignToImpl(const Bool checkAliasing, const Beta& beta, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Beta>::value) { m_expr.assignTo(checkAliasing, beta*m_alpha, dst); }
+	
+	template<typename Bool, typename Beta, class Dst>
+	void incrementImpl(const Bool checkAliasing, const Beta& beta, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Beta>::value) { m_expr.increment(checkAliasing, beta*m_alpha, dst); }
+	
+	template<typename Bool, typename Beta, class Dst>
+	void decrementImpl(const Bool checkAliasing, const Beta& beta, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Beta>::value) { m_expr.decrement(checkAliasing, beta*m_alpha, dst); }
+	
+	template<typename Bool, typename Beta, class Dst>
+	void multiplyImpl(const Bool checkAliasing, const Beta& beta, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Beta>::value) { m_expr.multiply(checkAliasing, beta*m_alpha, dst); }
+	
+	template<typename Bool, typename Beta, class Dst>
+	void divideImpl(const Bool checkAliasing, const Beta& beta, TensorBase<Dst>& dst) const requires(IsConvertibleTo<Dst>::value and IsScalar<Beta>::value) { m_expr.divide(checkAliasing, beta*m_alpha, dst); }
+private:
+	Alpha m_alpha;
+	std::conditional_t<Expr::isLeaf, const Expr&, Expr> m_expr;
+};
+
+namespace detail
+{
+
+template<typename Alpha, class Expr>
+struct StridedOperands< TensorScale<Alpha, Expr> >
+{
+	using Node     = TensorScale<Alpha, Expr>;
+	using Operands = StridedOperands<Expr>;
+	using Size     = typename Node::Size;
+	
+	static constexpr bool   value   = Operands::value;
+	static constexpr size_t n       = Operands::n;
+	static constexpr auto   strides = Operands::strides;
+	
+	static typename Node::Scalar get(const Node& node, const Size* offsets) { return node.m_alpha*Operands::get(node.m_expr, offsets); }
+};
+
+} // namespace detail
+
+template<typename Alpha, class Expr> 
+TensorScale<Alpha, Expr> operator*(const Alpha& alpha, const TensorBase<Expr>& expr) requires(IsScalar<Alpha>::value) { return TensorScale<Alpha,Expr>(alpha, expr); }
+
+template<typename Alpha, class Expr> 
+TensorScale<Alpha, Expr> operator*(const TensorBase<Expr>& expr, const Alpha& alpha) requires(IsScalar<Alpha>::value) { return TensorScale<Alpha,Expr>(alpha, expr); }
+
+template<typename Alpha, class Expr> 
+TensorScale<Alpha, Expr> operator/(const TensorBase<Expr>& expr, const Alpha& alpha) requires(IsScalar<Alpha>::value) { using RealScalar = typename NumTraits<Alpha>::Real; return TensorScale<Alpha,Expr>(BIC::fixed<RealScalar, 1.> / alpha, expr); }
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_SCALE_HPP
@@ -10,7 +10,20 @@ namespace TensorUtils
 {
 
 template<typename Size, size_t rank> constexpr std::array<Size, rank> getStrides(const std::array<Size, rank>& idx);
-	
+
+template<typename Size, size_t rank> constexpr bool isPermutation(const std::array<Size, rank>& axes);
+template<typename Size, size_t rank> constexpr bool isIdentity   (const std::array<Size, rank>& axes);
+
+// axes distinct and lower than rank
+template<typename Size, size_t n> constexpr bool areDistinctAxes(const std::array<Size, n>& axes, const size_t rank);
+
+// mask[d] is set when d is one of axes
+template<size_t rank, typename Size, size_t n> constexpr std::array<bool, rank> axesMask(const std::array<Size, n>& axes);
+
+// values of the dimensions not set in mask, and the converse scatter with zeros on the dimensions set in mask
+template<size_t n, typename Size, size_t rank> constexpr std::array<Size, n>    removeAxes (const std::array<Size, rank>& values, const std::array<bool, rank>& mask);
+template<typename Size, size_t n, size_t rank> constexpr std::array<Size, rank> insertZeros(const std::array<Size, n>&    values, const std::array<bool, rank>& mask);
+
 } // namespace TensorUtils
 } // namespace FSLinalg
 
@@ -22,7 +22,85 @@ constexpr std::array<Size, rank> getStrides(const std::array<Size, rank>& shape)
 	
 	return strides;
 }
+
+template<typename Size, size_t rank> 
+constexpr bool isPermutation(const std::array<Size, rank>& axes)
+{
+	std::array<bool, rank> isUsed{};
+	
+	for (Size i=0; i!=rank; ++i)
+	{
+		if (axes[i] >= rank or isUsed[axes[i]]) { return false; }
+		isUsed[axes[i]] = true;
+	}
+	
+	return true;
+}
+
+template<typename Size, size_t rank> 
+constexpr bool isIdentity(const std::array<Size, rank>& axes)
+{
+	for (Size i=0; i!=rank; ++i)
+	{
+		if (axes[i] != i) { return false; }
+	}
+	
+	return true;
+}
+
+template<typename Size, size_t n> 
+constexpr bool areDistinctAxes(const std::array<Size, n>& axes, const size_t rank)
+{
+	for (size_t i=0; i!=n; ++i)
+	{
+		if (axes[i] >= rank) { return false; }
+		for (size_t j=0; j!=i; ++j)
+		{
+			if (axes[i] == axes[j]) { return false; }
+		}
+	}
+	
+	return true;
+}
+
+template<size_t rank, typename Size, size_t n> 
+constexpr std::array<bool, rank> axesMask(const std::array<Size, n>& axes)
+{
+	std::array<bool, rank> mask{};
+	
+	for (size_t i=0; i!=n; ++i) { mask[axes[i]] = true; }
+	
+	return mask;
+}
+
+template<size_t n, typename Size, size_t rank> 
+constexpr std::array<Size, n> removeAxes(const std::array<Size, rank>& values, const std::array<bool, rank>& mask)
+{
+	std::array<Size, n> ret{};
+	
+	size_t k = 0;
+	for (size_t d=0; d!=rank; ++d)
+	{
+		if (not mask[d]) { ret[k++] = values[d]; }
+	}
+	
+	return ret;
+}
+
+template<typename Size, size_t n, size_t rank> 
+constexpr std::array<Size, rank> insertZeros(const std::array<Size, n>& values, const std::array<bool, rank>& mask)
+{
+	std::array<Size, rank> ret{};
 	
+	size_t k = 0;
+	for (size_t d=0; d!=rank; ++d)
+	{
+		ret[d] = mask[d] ? Size(0) : values[k++];
+	}
+	
+	return ret;
+}
+
 } // namespace TensorUtils
 } // namespace FSLinalg
 
@@ -0,0 +1,71 @@
+#ifndef FSLINALG_TENSOR_VIEW_HPP
+#define FSLINALG_TENSOR_VIEW_HPP
+
+#include <FSLinalg/Tensor/TensorBase.hpp>
+#include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Tensor/TensorUtils.hpp>
+#include <FSLinalg/misc/Overlap.hpp>
+
+#include <array>
+#include <type_traits>
+
+namespace FSLinalg
+{
+
+template<typename T, unsigned int... dims> class TensorView;
+
+template<typename T, unsigned int... dims>
+struct TensorTraits< TensorView<T, dims...> >
+{		
+	static_assert(sizeof...(dims) > 0);
+	
+	using Scalar = T;
+	using Size   = unsigned int;
+	using Shape  = std::array<Size, sizeof...(dims)>;
+	
+	static constexpr bool hasReadRandomAccess  = true;
+	static constexpr bool hasWriteRandomAccess = false;
+	static constexpr bool hasFlatRandomAccess  = true;
+	static constexpr bool hasStridedAccess     = true;
+	static constexpr bool causesAliasingIssues = false;
+	static constexpr bool isLeaf               = false; // a pointer, which expressions can safely hold by value
+	
+	static constexpr Shape shape   = Shape({dims...});
+	static constexpr Shape strides = TensorUtils::getStrides(shape);
+};
+
+// read-only view over row-major scalars owned elsewhere (e.g. a memory mapped file, see IO/BinaryReader.hpp)
+template<typename T, unsigned int... dims> 
+class TensorView : public TensorBase< TensorView<T, dims...> >
+{
+public:
+	using Self = TensorView<T, dims...>;
+	FSLINALG_DEFINE_TENSOR
+	
+	// the viewed scalars may be the storage of a dense destination (e.g. TensorView(T.data())), compared by storage
+	template<class Dst>
+	struct CanBeAlisaedTo : BIC::Fixed<bool,
+		    IsDenseTensor<Dst>::value
+		and std::is_same<Scalar, typename Dst::Scalar>::value > {};
+	
+	explicit TensorView(const T* data) : m_data(data) {}
+	
+	const T* data() const { return m_data; }
+	
+	const_ReturnType getImpl(const Size i) const { return m_data[i]; }
+	
+	template<std::integral... Idx> const_ReturnType getImpl(const Idx... idx) const requires(sizeof...(Idx) == rank) { return m_data[toFlatIndex(idx...)]; }
+	
+	template<class Dst>           bool isAliasedToImpl(const TensorBase<Dst>& dst) const requires(    CanBeAlisaedTo<Dst>::value) { return misc::overlap(data(), size, dst.derived().data(), Dst::size); }
+	template<class Dst> constexpr bool isAliasedToImpl(const TensorBase<Dst>&    ) const requires(not CanBeAlisaedTo<Dst>::value) { return false; }
+private:
+	template<std::integral... Idx, size_t... Is> Size toFlatIndexHelper(BIC::FixedIndices<Is...>, const Idx... idx) const requires(sizeof...(Idx) == rank and sizeof...(Is) == rank) { return ((idx*strides[Is]) + ...); } 
+	
+	template<std::integral... Idx> Size toFlatIndex(const Idx... idx) const requires(sizeof...(Idx) == rank) { return toFlatIndexHelper(BIC::indexSeq<0, rank>, idx...); } 
+	
+	const T* m_data;
+};
+
+} // namespace FSLinalg
+
+#endif // FSLINALG_TENSOR_VIEW_HPP
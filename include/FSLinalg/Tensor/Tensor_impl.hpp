@@ -2,9 +2,9 @@
 #define FSLINALG_TENSOR_IMPL_HPP
 
 #include <FSLinalg/Tensor/Tensor.hpp>
+#include <FSLinalg/Matrix/MatrixMap.hpp>
 
 #include <cassert>
-#include <random>
 
 namespace FSLinalg
 {
@@ -22,22 +22,16 @@ void Tensor<T,dims...>::initFromNestedInitializerList(misc::NestedInitializerLis
 		for (const misc::NestedInitializerList<U, d-1>& inner_values : values)
 		{
 			initFromNestedInitializerList<U, d-1>(inner_values, data);
-			data += strides[d-1];
+			data += strides[rank-d];
 		}
 	}
 }
 
 template<typename T, unsigned int... dims>
-auto Tensor<T,dims...>::random(const RealScalar& lb, const RealScalar& ub) -> Tensor
+auto Tensor<T,dims...>::random(RandomEngine& engine, const RealScalar& lb, const RealScalar& ub) -> Tensor
 {
-	std::random_device rd; 
-	std::mt19937 gen(rd()); 
-	std::uniform_real_distribution<RealScalar> dist(lb, ub);
-	
-	Tensor ret;
-	
-	for (Size i=0; i!=size; ++i) { ret[i] = dist(gen); }
-	
+	Tensor ret(RealScalar(0));
+	engine.fillUniform(std::span<Scalar>(ret.m_data), lb, ub);
 	return ret;
 }
 
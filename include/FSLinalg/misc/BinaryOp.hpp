@@ -39,37 +39,37 @@ struct Mod
 struct Equal
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs == rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs == rhs; }
 };
 	
 struct NotEqual
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs != rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs != rhs; }
 };
 	
 struct Greater
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs > rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs > rhs; }
 };
 	
 struct GreaterOrEqual
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs >= rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs >= rhs; }
 };
 	
 struct Lower
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs < rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs < rhs; }
 };
 	
 struct LowerOrEqual
 {
 	template<typename Lhs, typename Rhs>
-	constexpr bool operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs <= rhs; }
+	constexpr auto operator() (const Lhs& lhs, const Rhs& rhs) const { return lhs <= rhs; }
 };
 
 } // namespace BinaryOp
@@ -0,0 +1,52 @@
+#ifndef FSLINALG_MISC_FORMAT_SPEC_HPP
+#define FSLINALG_MISC_FORMAT_SPEC_HPP
+
+#include <fmt/format.h>
+
+#include <iterator>
+#include <string_view>
+
+namespace FSLinalg
+{
+namespace misc
+{
+
+/*
+ * Layout options of the Matrix and Tensor formatters. They come before the scalar format spec and are ended by '|':
+ *     {:.3e}     scalars formatted as {:.3e}
+ *     {:c|.3e}   entries listed column by column
+ *     {:s;|}     entries separated by ";" (s takes every character up to '|', so it comes last)
+ * A spec without '|' is a scalar spec only; use an empty option list ({:||>8}) when the scalar fill is '|'.
+ */
+struct FormatSpec
+{
+	bool             columnMajor = false;
+	std::string_view separator   = ", ";
+	
+	// parses the options at the beginning of ctx, if any, and advances ctx to the scalar spec
+	template<typename ParseContext>
+	constexpr void parse(ParseContext& ctx)
+	{
+		auto it  = ctx.begin();
+		auto bar = it;
+		while (bar != ctx.end() and *bar != '}' and *bar != '|') { ++bar; }
+		if (bar == ctx.end() or *bar != '|') { return; }
+		
+		while (it != bar)
+		{
+			switch (*it)
+			{
+				case 'r': columnMajor = false; ++it; break;
+				case 'c': columnMajor = true;  ++it; break;
+				case 's': separator = std::string_view(std::next(it), bar); it = bar; break;
+				default : throw fmt::format_error("invalid layout option, expected 'r', 'c' or 's'");
+			}
+		}
+		ctx.advance_to(std::next(bar));
+	}
+};
+
+} // namespace misc
+} // namespace FSLinalg
+
+#endif // FSLINALG_MISC_FORMAT_SPEC_HPP
@@ -0,0 +1,23 @@
+#ifndef FSLINALG_MISC_OVERLAP_HPP
+#define FSLINALG_MISC_OVERLAP_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace FSLinalg
+{
+namespace misc
+{
+
+// whether [a, a+na) and [b, b+nb) share an element, std::less ordering pointers into unrelated objects as well
+template<typename T>
+bool overlap(const T* a, const std::size_t na, const T* b, const std::size_t nb)
+{
+	constexpr std::less<const T*> less;
+	return less(a, b + nb) and less(b, a + na);
+}
+
+} // namespace misc
+} // namespace FSLinalg
+
+#endif // FSLINALG_MISC_OVERLAP_HPP
@@ -0,0 +1,60 @@
+#ifndef FSLINALG_REDUCTION_OPERATORS_HPP
+#define FSLINALG_REDUCTION_OPERATORS_HPP
+
+#include <FSLinalg/Scalar.hpp>
+
+#include <cmath>
+#include <limits>
+
+namespace FSLinalg
+{
+namespace ReductionOp
+{
+
+/*
+ * A reduction of n terms of type T starts from identity<T>(), folds each term in with accumulate, merges partial
+ * results with combine and turns the final result into a Result<T> with finalize(acc, n).
+ */
+struct Sum
+{
+	template<typename T> using Result = T;
+	
+	template<typename T> static constexpr T identity() { return T(0); }
+	
+	template<typename Acc, typename T> static constexpr Acc accumulate(const Acc& acc, const T& x) { return acc + x; }
+	template<typename Acc>             static constexpr Acc combine   (const Acc& a, const Acc& b) { return a + b; }
+	template<typename Acc>             static constexpr Acc finalize  (const Acc& acc, const unsigned int) { return acc; }
+};
+
+struct Mean : Sum
+{
+	template<typename Acc> static constexpr Acc finalize(const Acc& acc, const unsigned int n) { return acc / typename NumTraits<Acc>::Real(n); }
+};
+
+struct Max
+{
+	template<typename T> using Result = T;
+	
+	template<typename T> static constexpr T identity() { static_assert(IsRealScalar<T>::value, "Max is defined for real scalars only"); return std::numeric_limits<T>::lowest(); }
+	
+	template<typename Acc, typename T> static constexpr Acc accumulate(const Acc& acc, const T& x) { return (x > acc) ? Acc(x) : acc; }
+	template<typename Acc>             static constexpr Acc combine   (const Acc& a, const Acc& b) { return (b > a) ? b : a; }
+	template<typename Acc>             static constexpr Acc finalize  (const Acc& acc, const unsigned int) { return acc; }
+};
+
+// Euclidean norm, accumulated in the real type of T
+struct Norm
+{
+	template<typename T> using Result = typename NumTraits<T>::Real;
+	
+	template<typename T> static constexpr Result<T> identity() { return Result<T>(0); }
+	
+	template<typename Acc, typename T> static constexpr Acc accumulate(const Acc& acc, const T& x) { return acc + abs2(x); }
+	template<typename Acc>             static constexpr Acc combine   (const Acc& a, const Acc& b) { return a + b; }
+	template<typename Acc>             static           Acc finalize  (const Acc& acc, const unsigned int) { using std::sqrt; return sqrt(acc); }
+};
+
+} // namespace ReductionOp
+} // namespace FSLinalg
+
+#endif // FSLINALG_REDUCTION_OPERATORS_HPP
@@ -0,0 +1,13 @@
+#ifndef FSLINALG_MISC_RESTRICT_HPP
+#define FSLINALG_MISC_RESTRICT_HPP
+
+// pointer qualifier promising the compiler that the pointed memory is only reached through this pointer
+#if defined(__GNUC__) or defined(__clang__)
+#define FSLINALG_RESTRICT __restrict__
+#elif defined(_MSC_VER)
+#define FSLINALG_RESTRICT __restrict
+#else
+#define FSLINALG_RESTRICT
+#endif
+
+#endif // FSLINALG_MISC_RESTRICT_HPP
@@ -0,0 +1,62 @@
+#ifndef FSLINALG_MISC_STRIDED_LOOP_HPP
+#define FSLINALG_MISC_STRIDED_LOOP_HPP
+
+#include <cstddef>
+#include <array>
+
+#include <BIC/Core.hpp>
+
+namespace FSLinalg
+{
+namespace misc
+{
+
+/*
+ * Iterates over a compile-time shape and, for each position, calls func with one offset per operand
+ * (offset = sum of index[d]*strides[k][d]). Dimensions of extent one are dropped, adjacent dimensions
+ * that are contiguous for every operand are merged, the innermost dimension is a plain strided loop
+ * and short innermost extents are fully unrolled.
+ */
+template<std::array shape, std::array strides>
+struct StridedLoop
+{
+	using Size = typename decltype(shape)::value_type;
+	
+	static constexpr size_t rank       = shape.size();
+	static constexpr size_t nOperands  = strides.size();
+	static constexpr Size   unrollSize = 4;
+	
+	static_assert(rank > 0);
+	static_assert(nOperands > 0);
+	static_assert(std::tuple_size<typename decltype(strides)::value_type>::value == rank, "Each operand needs one stride per dimension");
+	
+	struct Layout
+	{
+		size_t                                        nDims;
+		std::array<Size, rank>                        extents;
+		std::array<std::array<Size, rank>, nOperands> steps;
+	};
+	
+	static constexpr Layout collapse();
+	
+	static constexpr Layout layout = collapse();
+	
+	using Offsets = std::array<Size, nOperands>;
+	
+	template<class Func> static constexpr void run(Func&& func);
+private:
+	template<size_t d, class Func> static constexpr void loop(Func& func, const Offsets& offsets);
+	
+	template<size_t... Ks, class Func> static constexpr void call(BIC::FixedIndices<Ks...>, Func& func, const Offsets& offsets, const Size j);
+	template<size_t... Js, class Func> static constexpr void unroll(BIC::FixedIndices<Js...>, Func& func, const Offsets& offsets);
+};
+
+template<std::array shape, std::array strides, class Func>
+constexpr void stridedLoop(Func&& func);
+
+} // namespace misc
+} // namespace FSLinalg
+
+#include <FSLinalg/misc/StridedLoop_impl.hpp>
+
+#endif // FSLINALG_MISC_STRIDED_LOOP_HPP
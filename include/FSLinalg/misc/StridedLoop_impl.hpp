@@ -0,0 +1,104 @@
+#ifndef FSLINALG_MISC_STRIDED_LOOP_IMPL_HPP
+#define FSLINALG_MISC_STRIDED_LOOP_IMPL_HPP
+
+#include <FSLinalg/misc/StridedLoop.hpp>
+
+namespace FSLinalg
+{
+namespace misc
+{
+
+template<std::array shape, std::array strides>
+constexpr auto StridedLoop<shape, strides>::collapse() -> Layout
+{
+	Layout ret{};
+	
+	for (size_t d=0; d!=rank; ++d)
+	{
+		if (shape[d] == Size(1)) { continue; }
+		
+		bool isContiguous = ret.nDims != 0;
+		for (size_t k=0; k!=nOperands and isContiguous; ++k)
+		{
+			isContiguous = ret.steps[k][ret.nDims-1] == strides[k][d]*shape[d];
+		}
+		
+		if (isContiguous)
+		{
+			ret.extents[ret.nDims-1] *= shape[d];
+			for (size_t k=0; k!=nOperands; ++k) { ret.steps[k][ret.nDims-1] = strides[k][d]; }
+		}
+		else
+		{
+			ret.extents[ret.nDims] = shape[d];
+			for (size_t k=0; k!=nOperands; ++k) { ret.steps[k][ret.nDims] = strides[k][d]; }
+			++ret.nDims;
+		}
+	}
+	
+	if (ret.nDims == 0)
+	{
+		ret.nDims    = 1;
+		ret.extents[0] = Size(1);
+	}
+	
+	return ret;
+}
+
+template<std::array shape, std::array strides> template<class Func>
+constexpr void StridedLoop<shape, strides>::run(Func&& func)
+{
+	loop<0>(func, Offsets{});
+}
+
+template<std::array shape, std::array strides> template<size_t d, class Func>
+constexpr void StridedLoop<shape, strides>::loop(Func& func, const Offsets& offsets)
+{
+	constexpr Size n = layout.extents[d];
+	
+	if constexpr (d+1 == layout.nDims)
+	{
+		if constexpr (n <= unrollSize)
+		{
+			unroll(BIC::indexSeq<0, n>, func, offsets);
+		}
+		else
+		{
+			for (Size j=0; j!=n; ++j) { call(BIC::indexSeq<0, nOperands>, func, offsets, j); }
+		}
+	}
+	else
+	{
+		Offsets inner = offsets;
+		for (Size i=0; i!=n; ++i)
+		{
+			loop<d+1>(func, inner);
+			for (size_t k=0; k!=nOperands; ++k) { inner[k] += layout.steps[k][d]; }
+		}
+	}
+}
+
+template<std::array shape, std::array strides> template<size_t... Ks, class Func>
+constexpr void StridedLoop<shape, strides>::call(BIC::FixedIndices<Ks...>, Func& func, const Offsets& offsets, const Size j)
+{
+	constexpr size_t d = layout.nDims-1;
+	
+	func((offsets[Ks] + j*layout.steps[Ks][d])...);
+}
+
+template<std::array shape, std::array strides> template<size_t... Js, class Func>
+constexpr void StridedLoop<shape, strides>::unroll(BIC::FixedIndices<Js...>, Func& func, const Offsets& offsets)
+{
+	(call(BIC::indexSeq<0, nOperands>, func, offsets, Size(Js)), ...);
+}
+
+template<std::array shape, std::array strides, class Func>
+constexpr void stridedLoop(Func&& func)
+{
+	StridedLoop<shape, strides>::run(std::forward<Func>(func));
+}
+
+} // namespace misc
+} // namespace FSLinalg
+
+#endif // FSLINALG_MISC_STRIDED_LOOP_IMPL_HPP
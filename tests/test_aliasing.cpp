@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Tensor.hpp>
 
 TEST(aliasing, cross)
 {
@@ -61,6 +62,30 @@ TEST(aliasing, transposed)
 	EXPECT_EQ(A, expected);
 }
 
+TEST(aliasing, views)
+{
+	FSLinalg::RealMatrix<3,3> A({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+	FSLinalg::RealMatrix<3,3> expectedA({{1, 4, 7}, {2, 5, 8}, {3, 6, 9}});
+	
+	const FSLinalg::MatrixView<double,3,3> viewA(A.data());
+	
+	A = FSLinalg::transpose(viewA);
+	
+	EXPECT_EQ(A, expectedA);
+	
+	FSLinalg::RealTensor<3,3> f({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+	FSLinalg::RealTensor<3,3> expectedF({{1, 4, 7}, {2, 5, 8}, {3, 6, 9}});
+	
+	const FSLinalg::TensorView<double,3,3> viewF(f.data());
+	
+	f = permute<1,0>(viewF);
+	
+	EXPECT_EQ(f, expectedF);
+	
+	static_assert(    FSLinalg::MatrixView<double,3,3>::CanBeAlisaedTo< FSLinalg::RealMatrix<3,3> >::value);
+	static_assert(not FSLinalg::MatrixView<double,3,3>::CanBeAlisaedTo< FSLinalg::CpxMatrix<3,3>  >::value);
+}
+
 TEST(aliasing, product)
 {
 	FSLinalg::RealMatrix<6,6> A({
@@ -93,3 +118,110 @@ TEST(aliasing, product)
 	
 	EXPECT_EQ(A, expected);
 }
+
+TEST(aliasing, strategies)
+{
+	using Mat = FSLinalg::RealMatrix<5,5>;
+	using Vec = FSLinalg::RealRowVector<5>;
+	
+	const Mat A0 = Mat::random();
+	const Mat B  = Mat::random();
+	const Vec x0 = Vec::random();
+	
+	// dst = dst*B: row buffer
+	{
+		Mat A = A0;
+		const Mat expected = 2.*A0*B;
+		FSLinalg::resetAliasingStrategy();
+		A = 2.*A*B;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::RowBuffer);
+		EXPECT_EQ(A, expected);
+		
+		const Mat incremented = A + B*A0;
+		A += B*A0;
+		EXPECT_EQ(A, incremented);
+	}
+	
+	// dst = B*dst: column buffer
+	{
+		Vec x = x0;
+		const Vec expected = B*x0;
+		x = B*x;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::ColumnBuffer);
+		EXPECT_EQ(x, expected);
+		
+		Mat A = A0;
+		const Mat decremented = A0 - FSLinalg::transpose(B)*A0;
+		A -= FSLinalg::transpose(B)*A;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::ColumnBuffer);
+		EXPECT_EQ(A, decremented);
+	}
+	
+	// both operands aliased, or transposed aliased operand: full temporary
+	{
+		Mat A = A0;
+		const Mat expected = A0*A0;
+		A = A*A;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::Temporary);
+		EXPECT_EQ(A, expected);
+		
+		A = A0;
+		const Mat expectedT = FSLinalg::transpose(A0)*B;
+		A = FSLinalg::transpose(A)*B;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::Temporary);
+		EXPECT_EQ(A, expectedT);
+	}
+	
+	// dst = transpose(dst): in place
+	{
+		Mat A = A0;
+		const Mat expected = A0 + FSLinalg::transpose(A0);
+		A += FSLinalg::transpose(A);
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::InPlaceTranspose);
+		EXPECT_EQ(A, expected);
+		
+		A = A0;
+		const Mat transposed = FSLinalg::transpose(A0);
+		A = FSLinalg::transpose(A);
+		EXPECT_EQ(A, transposed);
+	}
+	
+	// no aliasing, nothing recorded
+	{
+		FSLinalg::resetAliasingStrategy();
+		Mat C = A0*B;
+		C = A0*B;
+		EXPECT_EQ(FSLinalg::lastAliasingStrategy(), FSLinalg::AliasingStrategy::None);
+	}
+}
+
+TEST(aliasing, noalias)
+{
+	using Mat = FSLinalg::RealMatrix<4,4>;
+	
+	const Mat A = Mat::random();
+	const Mat B = Mat::random();
+	
+	Mat C(0.);
+	C.noalias() = A*B;
+	EXPECT_EQ(C, Mat(A*B));
+	
+	Mat expected = A*B;
+	expected += 2.*A;
+	expected -= A*B;
+	
+	C.noalias() += 2.*A;
+	C.noalias() -= A*B;
+	EXPECT_EQ(C, expected);
+	
+	// types that cannot share memory with the destination are known not to alias at compile time
+	using Unit = FSLinalg::UnitMatrix<4,4>;
+	using Cpx  = FSLinalg::CpxMatrix<4,4>;
+	
+	static_assert(    Mat::CanBeAlisaedTo<Mat>::value);
+	static_assert(not Mat::CanBeAlisaedTo<Cpx>::value);
+	static_assert(not Unit::CanBeAlisaedTo<Mat>::value);
+	static_assert(    decltype(A*B + A)::CanBeAlisaedTo<Mat>::value);
+	static_assert(not decltype(A*B + A)::CanBeAlisaedTo<Cpx>::value);
+	static_assert(not decltype(FSLinalg::transpose(A)*B)::CanBeAlisaedTo<FSLinalg::RealMatrix<4,3>>::value);
+}
@@ -0,0 +1,422 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Tensor.hpp>
+#include <FSLinalg/BasicLinalg/MultiplyAdd.hpp>
+#include <FSLinalg/BasicLinalg/InnerProduct.hpp>
+#include <FSLinalg/BasicLinalg/Norm.hpp>
+#include <FSLinalg/BasicLinalg/QuadraticForm.hpp>
+#include <FSLinalg/BasicLinalg/PartialPivotLU.hpp>
+#include <FSLinalg/BasicLinalg/MatrixExponential.hpp>
+
+#include <cmath>
+#include <vector>
+
+// the tests_fslinalg_fma target builds this file with -mfma, so that multiply-adds go through std::fma
+#if defined(FSLINALG_TESTS_FMA) and not (defined(FP_FAST_FMA) and defined(FP_FAST_FMAF))
+#error "the fma tests must be built for a target with a hardware fused multiply-add"
+#endif
+
+TEST(basic_linalg, multiply_add)
+{
+	using Cpx = std::complex<double>;
+	
+	constexpr FSLinalg::BasicLinalg::MultiplyAdd<false,false> madd;
+	constexpr FSLinalg::BasicLinalg::MultiplyAdd<true,false>  maddConjA;
+	constexpr FSLinalg::BasicLinalg::MultiplyAdd<false,true>  maddConjB;
+	
+	EXPECT_EQ(madd(2., 3., 1.), 7.);
+	EXPECT_EQ(madd(2.f, 3., 1.), 7.);
+	EXPECT_EQ(madd(Cpx(1, 2), Cpx(3, -1), Cpx(1, 1)), Cpx(6, 6));
+	EXPECT_EQ(maddConjA(Cpx(1, 2), Cpx(3, -1), Cpx(1, 1)), Cpx(2, -6));
+	EXPECT_EQ(maddConjB(Cpx(1, 2), Cpx(3, -1), Cpx(1, 1)), Cpx(2, 8));
+	EXPECT_EQ(maddConjB(2., Cpx(3, -1), Cpx(1, 1)), Cpx(7, 3));
+	EXPECT_EQ(maddConjA(Cpx(3, -1), 2., 1.), Cpx(7, 2));
+	
+	// the product is rounded once when the target has a hardware fused multiply-add, a*b + c is left to the compiler otherwise
+#ifdef FP_FAST_FMA
+	const double eps = std::numeric_limits<double>::epsilon();
+	const double a   = 1. + eps;
+	const double res = madd(a, a, -(1. + 2.*eps));
+	
+	EXPECT_EQ(res, eps*eps);
+	EXPECT_EQ(FSLinalg::BasicLinalg::fusedMultiplyAdd(a, a, -1.), std::fma(a, a, -1.));
+#endif
+#ifdef FP_FAST_FMAF
+	const float epsf = std::numeric_limits<float>::epsilon();
+	const float af   = 1.f + epsf;
+	
+	EXPECT_EQ(madd(af, af, -(1.f + 2.f*epsf)), epsf*epsf);
+	EXPECT_EQ(FSLinalg::BasicLinalg::fusedMultiplyAdd(af, af, -1.f), std::fma(af, af, -1.f));
+#endif
+}
+
+TEST(basic_linalg, tensor_multiply_add)
+{
+	FSLinalg::RealTensor<3> a({2, 4, 1});
+	FSLinalg::RealTensor<3> b({1, 5, -1});
+	FSLinalg::RealTensor<3> c({3, -2, 0});
+	
+	using Expr1 = decltype(a*b + c);
+	using Expr2 = decltype(c + a*b);
+	using Expr3 = decltype(a + b);
+	
+	static_assert(Expr1::isLhsMultiplyAdd and not Expr1::isRhsMultiplyAdd);
+	static_assert(Expr2::isRhsMultiplyAdd and not Expr2::isLhsMultiplyAdd);
+	static_assert(not Expr3::isLhsMultiplyAdd and not Expr3::isRhsMultiplyAdd);
+	
+	FSLinalg::RealTensor<3> expected({5, 18, -1});
+	
+	EXPECT_EQ(a*b + c, expected);
+	EXPECT_EQ(c + a*b, expected);
+	EXPECT_EQ(FSLinalg::RealTensor<3>(c + b*a), expected);
+}
+
+TEST(basic_linalg, reduction)
+{
+	// 11 terms over 4 accumulators: ((0+4+8) + (1+5+9)) + ((2+6+10) + (3+7))
+	const unsigned int res = FSLinalg::BasicLinalg::Reduction<11,4>::run<unsigned int>([](unsigned int& acc, const unsigned int i) -> void { acc += i; });
+	
+	EXPECT_EQ(res, 55);
+	
+	// the pairwise combine keeps small terms that a sequential sum would absorb: big + 1 rounds to big at 2^53, so that
+	// big + 1 + 1 + 1 gives big while (big + 1) + (1 + 1) gives big + 2
+	const double big = 2. / std::numeric_limits<double>::epsilon();
+	const double sum = FSLinalg::BasicLinalg::Reduction<4,4>::run<double>([&](double& acc, const unsigned int i) -> void { acc += (i == 0 ? big : 1.); });
+	
+	EXPECT_EQ(big + 1. + 1. + 1., big);
+	EXPECT_EQ(sum, big + 2.);
+}
+
+TEST(basic_linalg, inner_and_norm)
+{
+	using Cpx = std::complex<double>;
+	
+	FSLinalg::RealMatrix<19,1> x;
+	FSLinalg::RealMatrix<19,1> y;
+	
+	double expected = 0.;
+	double expectedSquaredNorm = 0.;
+	for (unsigned int i=0; i!=19; ++i)
+	{
+		x[i] = double(i) - 3.;
+		y[i] = 2.*double(i) + 1.;
+		expected += x[i]*y[i];
+		expectedSquaredNorm += x[i]*x[i];
+	}
+	
+	EXPECT_EQ(FSLinalg::inner(x, y), expected);
+	EXPECT_EQ(FSLinalg::inner(x, 2.*y), 2.*expected);
+	EXPECT_EQ(FSLinalg::inner(FSLinalg::transpose(x), FSLinalg::transpose(y)), expected);
+	EXPECT_EQ(FSLinalg::squaredNorm(x), expectedSquaredNorm);
+	EXPECT_EQ(FSLinalg::squaredNorm(x - y), FSLinalg::inner(x - y, x - y));
+	EXPECT_DOUBLE_EQ(FSLinalg::norm(x), std::sqrt(expectedSquaredNorm));
+	
+	FSLinalg::CpxMatrix<2,2> a({{Cpx(1, 2), Cpx(0, -1)}, {Cpx(3, 0), Cpx(-1, 1)}});
+	FSLinalg::CpxMatrix<2,2> b({{Cpx(2, 0), Cpx(1,  1)}, {Cpx(0, 1), Cpx( 1, 1)}});
+	
+	EXPECT_EQ(FSLinalg::inner(a, b), Cpx(2, -4) + Cpx(-1, 1) + Cpx(0, 3) + Cpx(0, -2));
+	EXPECT_EQ(FSLinalg::squaredNorm(a), 5. + 1. + 9. + 2.);
+}
+
+TEST(basic_linalg, batched_inner)
+{
+	using Vec = FSLinalg::RealMatrix<7,1>;
+	
+	std::vector<Vec> x;
+	std::vector<Vec> y;
+	
+	for (unsigned int p=0; p!=11; ++p)
+	{
+		x.push_back(Vec::random());
+		y.push_back(Vec::random());
+	}
+	
+	std::vector<double> res(11);
+	FSLinalg::inner(std::span<const Vec>(x), std::span<const Vec>(y), std::span<double>(res));
+	
+	// the batched and single pair reductions may contract into fma differently: compared relatively to |x|*|y|
+	for (unsigned int p=0; p!=11; ++p)
+	{
+		const double scale = std::sqrt(FSLinalg::squaredNorm(x[p])*FSLinalg::squaredNorm(y[p]));
+		EXPECT_LE(std::abs(res[p] - FSLinalg::inner(x[p], y[p])), 1e-15*scale);
+	}
+	
+	// complex pairs and a float result
+	using CpxVec = FSLinalg::CpxMatrix<1,5>;
+	
+	std::vector<CpxVec> a;
+	std::vector<CpxVec> b;
+	
+	for (unsigned int p=0; p!=6; ++p)
+	{
+		a.push_back(CpxVec::random());
+		b.push_back(CpxVec::random());
+	}
+	
+	std::vector< std::complex<double> > cpxRes(6);
+	FSLinalg::inner(std::span<const CpxVec>(a), std::span<const CpxVec>(b), std::span< std::complex<double> >(cpxRes));
+	
+	for (unsigned int p=0; p!=6; ++p)
+	{
+		const double scale = std::sqrt(FSLinalg::squaredNorm(a[p])*FSLinalg::squaredNorm(b[p]));
+		EXPECT_LE(std::abs(cpxRes[p] - FSLinalg::inner(a[p], b[p])), 1e-15*scale);
+	}
+}
+
+TEST(basic_linalg, mixed_precision)
+{
+	using FloatMatrix  = FSLinalg::Matrix<float,2,2>;
+	using DoubleMatrix = FSLinalg::RealMatrix<2,2>;
+	
+	// x*x is not representable in float but is in double
+	const float  x      = 1.f + std::numeric_limits<float>::epsilon();
+	const double xx     = double(x)*double(x);
+	const float  xxf    = x*x;
+	
+	ASSERT_NE(double(xxf), xx);
+	
+	const FloatMatrix A({{x, 0}, {0, 1}});
+	const FloatMatrix B({{x, 1}, {0, 1}});
+	
+	// cast leaves are not converted, the product is computed and accumulated in double
+	using WideProduct = decltype(FSLinalg::cast<double>(A)*B);
+	static_assert(not WideProduct::createTemporaryLhs);
+	
+	const DoubleMatrix C(FSLinalg::cast<double>(A)*B);
+	
+	EXPECT_EQ(C, DoubleMatrix({{xx, double(x)}, {0, 1}}));
+	EXPECT_EQ(FloatMatrix(A*B), FloatMatrix({{xxf, x}, {0, 1}}));
+	
+	// narrowing casts evaluate in double and round once
+	const DoubleMatrix Ad(FSLinalg::cast<double>(A));
+	const DoubleMatrix Bd(FSLinalg::cast<double>(B));
+	
+	EXPECT_EQ(FloatMatrix(FSLinalg::cast<float>(Ad*Bd)), FloatMatrix({{float(xx), x}, {0, 1}}));
+	
+	// accumulator selected per call
+	const FSLinalg::Matrix<float,1,1> v({x});
+	
+	EXPECT_EQ(FSLinalg::inner(v, v), xxf);
+	EXPECT_EQ(FSLinalg::inner<double>(v, v), xx);
+	EXPECT_EQ(FSLinalg::squaredNorm<double>(v), xx);
+	EXPECT_EQ(FSLinalg::squaredNorm(FSLinalg::cast<double>(v)), xx);
+}
+
+template<unsigned int Nrows, unsigned int Ncols>
+FSLinalg::CpxMatrix<Nrows,Ncols> randomCpx()
+{
+	const FSLinalg::RealMatrix<Nrows,Ncols> re = FSLinalg::RealMatrix<Nrows,Ncols>::random();
+	const FSLinalg::RealMatrix<Nrows,Ncols> im = FSLinalg::RealMatrix<Nrows,Ncols>::random();
+	
+	FSLinalg::CpxMatrix<Nrows,Ncols> ret(0.);
+	for (unsigned int i=0; i!=Nrows*Ncols; ++i) { ret[i] = std::complex<double>(re[i], im[i]); }
+	return ret;
+}
+
+TEST(basic_linalg, quadratic_forms)
+{
+	const FSLinalg::RealMatrix<5,4> A = FSLinalg::RealMatrix<5,4>::random();
+	const FSLinalg::RealRowVector<5> x = FSLinalg::RealRowVector<5>::random();
+	const FSLinalg::RealRowVector<4> y = FSLinalg::RealRowVector<4>::random();
+	
+	EXPECT_NEAR(FSLinalg::quadForm(x, A, y), FSLinalg::inner(x, A*y), 1e-12);
+	EXPECT_NEAR(FSLinalg::quadForm(x, 2.*A, y + y), 4.*FSLinalg::inner(x, A*y), 1e-12);
+	
+	const FSLinalg::CpxMatrix<3,3> Ac = randomCpx<3,3>();
+	const FSLinalg::CpxRowVector<3> xc = randomCpx<3,1>();
+	const FSLinalg::CpxRowVector<3> yc = randomCpx<3,1>();
+	
+	EXPECT_NEAR(std::abs(FSLinalg::quadForm(xc, Ac, yc) - FSLinalg::inner(xc, Ac*yc)), 0., 1e-12);
+	
+	// symmetric D
+	const FSLinalg::RealMatrix<5,5> S = FSLinalg::RealMatrix<5,5>::random();
+	const FSLinalg::RealMatrix<5,5> D = S + FSLinalg::transpose(S);
+	const FSLinalg::RealMatrix<5,3> B = FSLinalg::RealMatrix<5,3>::random();
+	
+	const FSLinalg::RealMatrix<3,3> expected = FSLinalg::transpose(B)*D*B;
+	
+	FSLinalg::RealMatrix<3,3> C = FSLinalg::congruence(B, D);
+	for (unsigned int i=0; i!=3; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j)
+		{
+			EXPECT_NEAR(C(i,j), expected(i,j), 1e-12);
+		}
+		EXPECT_EQ(C(i,(i+1)%3), C((i+1)%3,i));
+	}
+	
+	C += FSLinalg::congruence(B, D);
+	C -= 3.*FSLinalg::congruence(B, D);
+	for (unsigned int i=0; i!=9; ++i) { EXPECT_NEAR(C[i], -expected[i], 1e-12); }
+	
+	// hermitian D, the diagonal is real
+	const FSLinalg::CpxMatrix<3,3> Sc = randomCpx<3,3>();
+	const FSLinalg::CpxMatrix<3,3> Dc = Sc + FSLinalg::adjoint(Sc);
+	const FSLinalg::CpxMatrix<3,2> Bc = randomCpx<3,2>();
+	
+	const FSLinalg::CpxMatrix<2,2> expectedc = FSLinalg::adjoint(Bc)*Dc*Bc;
+	const FSLinalg::CpxMatrix<2,2> Cc = FSLinalg::congruence(Bc, Dc);
+	for (unsigned int i=0; i!=4; ++i) { EXPECT_NEAR(std::abs(Cc[i] - expectedc[i]), 0., 1e-12); }
+	EXPECT_EQ(Cc(0,1), std::conj(Cc(1,0)));
+	
+	// complex scale, the result is no longer hermitian
+	const std::complex<double> alpha(0.5, -2.);
+	FSLinalg::CpxMatrix<2,2> Cs = alpha*FSLinalg::congruence(Bc, Dc);
+	for (unsigned int i=0; i!=4; ++i) { EXPECT_NEAR(std::abs(Cs[i] - alpha*expectedc[i]), 0., 1e-12); }
+	
+	Cs += alpha*FSLinalg::congruence(Bc, Dc);
+	for (unsigned int i=0; i!=4; ++i) { EXPECT_NEAR(std::abs(Cs[i] - 2.*alpha*expectedc[i]), 0., 1e-12); }
+	
+	// aliased destination
+	FSLinalg::RealMatrix<3,3> E = FSLinalg::RealMatrix<3,3>::random();
+	FSLinalg::RealMatrix<3,3> F = E;
+	const FSLinalg::RealMatrix<3,3> G = FSLinalg::RealMatrix<3,3>(E + FSLinalg::transpose(E));
+	F = FSLinalg::congruence(F, G);
+	const FSLinalg::RealMatrix<3,3> expectedF = FSLinalg::transpose(E)*G*E;
+	for (unsigned int i=0; i!=9; ++i) { EXPECT_NEAR(F[i], expectedF[i], 1e-12); }
+}
+
+TEST(basic_linalg, rank_update)
+{
+	using Cpx = std::complex<double>;
+	
+	const FSLinalg::RealMatrix<7,3> U = FSLinalg::RealMatrix<7,3>::random();
+	const FSLinalg::RealMatrix<5,3> V = FSLinalg::RealMatrix<5,3>::random();
+	const FSLinalg::RealRowVector<7> u = FSLinalg::RealRowVector<7>::random();
+	const FSLinalg::RealRowVector<5> v = FSLinalg::RealRowVector<5>::random();
+	const FSLinalg::RealMatrix<7,5> A0 = FSLinalg::RealMatrix<7,5>::random();
+	
+	FSLinalg::RealMatrix<7,5> A = A0;
+	A += 2.*outer(u, v);
+	A -= U*FSLinalg::transpose(V);
+	
+	for (unsigned int i=0; i!=7; ++i)
+	{
+		for (unsigned int j=0; j!=5; ++j)
+		{
+			double expected = A0(i,j) + 2.*u[i]*v[j];
+			for (unsigned int k=0; k!=3; ++k) { expected -= U(i,k)*V(j,k); }
+			EXPECT_NEAR(A(i,j), expected, 1e-12);
+		}
+	}
+	
+	// symmetric update, the starting matrix need not be symmetric
+	const FSLinalg::RealMatrix<7,7> H0 = FSLinalg::RealMatrix<7,7>::random();
+	
+	FSLinalg::RealMatrix<7,7> H = H0;
+	H += 0.5*(U*FSLinalg::transpose(U));
+	
+	FSLinalg::RealMatrix<7,7> G = U*FSLinalg::transpose(U);
+	
+	for (unsigned int i=0; i!=7; ++i)
+	{
+		for (unsigned int j=0; j!=7; ++j)
+		{
+			double expected = 0.;
+			for (unsigned int k=0; k!=3; ++k) { expected += U(i,k)*U(j,k); }
+			EXPECT_NEAR(H(i,j), H0(i,j) + 0.5*expected, 1e-12);
+			EXPECT_NEAR(G(i,j), expected, 1e-12);
+		}
+	}
+	
+	// hermitian update
+	FSLinalg::CpxMatrix<5,2> Uc(0.);
+	for (unsigned int i=0; i!=10; ++i) { Uc[i] = Cpx(U[i], V[i]); }
+	
+	const FSLinalg::CpxMatrix<5,5> Hc = Uc*FSLinalg::adjoint(Uc);
+	const FSLinalg::CpxMatrix<5,5> Tc = Uc*FSLinalg::transpose(Uc);
+	
+	for (unsigned int i=0; i!=5; ++i)
+	{
+		for (unsigned int j=0; j!=5; ++j)
+		{
+			Cpx expectedH = 0.;
+			Cpx expectedT = 0.;
+			for (unsigned int k=0; k!=2; ++k) 
+			{ 
+				expectedH += Uc(i,k)*std::conj(Uc(j,k)); 
+				expectedT += Uc(i,k)*Uc(j,k); 
+			}
+			EXPECT_NEAR(std::abs(Hc(i,j) - expectedH), 0., 1e-12);
+			EXPECT_NEAR(std::abs(Tc(i,j) - expectedT), 0., 1e-12);
+		}
+	}
+}
+
+TEST(basic_linalg, lu)
+{
+	using Mat = FSLinalg::RealMatrix<4,4>;
+	
+	// the first pivot is zero without row exchanges
+	const Mat A({{0, 2, 1, 3}, {1, 1, 0, 2}, {4, -1, 2, 0}, {2, 3, -3, 1}});
+	const FSLinalg::RealMatrix<4,2> B({{1, 0}, {2, 1}, {3, -1}, {4, 2}});
+	
+	const auto decomposition = FSLinalg::lu(A);
+	
+	ASSERT_TRUE(decomposition.isInvertible());
+	
+	const FSLinalg::RealMatrix<4,2> X = decomposition.solve(B);
+	const FSLinalg::RealMatrix<4,2> AX = A*X;
+	for (unsigned int i=0; i!=8; ++i) { EXPECT_NEAR(AX[i], B[i], 1e-13); }
+	
+	const Mat AinvA = decomposition.inverse()*A;
+	for (unsigned int i=0; i!=4; ++i)
+	{
+		for (unsigned int j=0; j!=4; ++j) { EXPECT_NEAR(AinvA(i,j), (i == j) ? 1. : 0., 1e-13); }
+	}
+	
+	// expanded along the first column
+	EXPECT_NEAR(decomposition.determinant(), 44., 1e-12);
+	
+	const Mat S({{1, 2, 3, 4}, {2, 4, 6, 8}, {0, 1, 0, 1}, {1, 0, 1, 0}});
+	EXPECT_FALSE(FSLinalg::lu(S).isInvertible());
+	EXPECT_EQ(FSLinalg::lu(S).determinant(), 0.);
+}
+
+TEST(basic_linalg, matrix_exponential)
+{
+	using Cpx = std::complex<double>;
+	
+	// nilpotent: exp(N) = I + N + N^2/2
+	const FSLinalg::RealMatrix<3,3> N({{0, 1, 2}, {0, 0, 3}, {0, 0, 0}});
+	const FSLinalg::RealMatrix<3,3> expN = FSLinalg::exp(N);
+	const FSLinalg::RealMatrix<3,3> expectedN({{1, 1, 3.5}, {0, 1, 3}, {0, 0, 1}});
+	for (unsigned int i=0; i!=9; ++i) { EXPECT_NEAR(expN[i], expectedN[i], 1e-14); }
+	
+	// diagonal with a large norm, which needs squarings
+	const FSLinalg::RealMatrix<2,2> D({{-3, 0}, {0, 12}});
+	const FSLinalg::RealMatrix<2,2> expD = FSLinalg::exp(D);
+	EXPECT_NEAR(expD(0,0), std::exp(-3.), 1e-14);
+	EXPECT_NEAR(expD(1,1)/std::exp(12.), 1., 1e-13);
+	EXPECT_EQ(expD(0,1), 0.);
+	
+	// rotation generator, exp(t [[0,-1],[1,0]]) = [[cos t, -sin t], [sin t, cos t]]
+	const double t = 7.5;
+	const FSLinalg::RealMatrix<2,2> G({{0, -t}, {t, 0}});
+	const FSLinalg::RealMatrix<2,2> expG = FSLinalg::exp(G);
+	EXPECT_NEAR(expG(0,0),  std::cos(t), 1e-13);
+	EXPECT_NEAR(expG(0,1), -std::sin(t), 1e-13);
+	EXPECT_NEAR(expG(1,0),  std::sin(t), 1e-13);
+	
+	// exp(A) exp(-A) = I
+	const FSLinalg::RealMatrix<6,6> A = 2.*FSLinalg::RealMatrix<6,6>::random();
+	const FSLinalg::RealMatrix<6,6> P = FSLinalg::exp(A)*FSLinalg::exp((-1.)*A);
+	for (unsigned int i=0; i!=6; ++i)
+	{
+		for (unsigned int j=0; j!=6; ++j) { EXPECT_NEAR(P(i,j), (i == j) ? 1. : 0., 1e-11); }
+	}
+	
+	// complex diagonal, exp(i theta) on each entry
+	FSLinalg::CpxMatrix<2,2> Z(0.);
+	Z(0,0) = Cpx(0,  2);
+	Z(1,1) = Cpx(0, -1);
+	const FSLinalg::CpxMatrix<2,2> expZ = FSLinalg::exp(Z);
+	EXPECT_NEAR(std::abs(expZ(0,0) - std::exp(Cpx(0,  2))), 0., 1e-14);
+	EXPECT_NEAR(std::abs(expZ(1,1) - std::exp(Cpx(0, -1))), 0., 1e-14);
+	EXPECT_NEAR(std::abs(expZ(0,1)), 0., 1e-14);
+	
+	// single precision uses a lower Pade degree
+	const FSLinalg::Matrix<float,2,2> F({{0.f, -1.f}, {1.f, 0.f}});
+	EXPECT_NEAR(FSLinalg::exp(F)(1,0), std::sin(1.f), 1e-6f);
+}
@@ -208,3 +208,134 @@ TEST(chain, general)
 	EXPECT_EQ(expected, result2);
 	EXPECT_EQ(expected, rebrackedResult);
 }
+
+TEST(chain, skew)
+{
+	using Mat3 = FSLinalg::RealMatrix<3,3>;
+	
+	const FSLinalg::RealRowVector<3> a({1, -2, 3});
+	const FSLinalg::RealRowVector<3> b({0.5, 4, -1});
+	const FSLinalg::RealRowVector<3> v({2, 1, -3});
+	const FSLinalg::RealMatrix<3,3>  R({{0, -1, 0}, {1, 0, 0}, {0, 0, 1}});
+	
+	const FSLinalg::RealMatrix<3,3> Sa({{0, -a[2], a[1]}, {a[2], 0, -a[0]}, {-a[1], a[0], 0}});
+	const FSLinalg::RealMatrix<3,3> Sb({{0, -b[2], b[1]}, {b[2], 0, -b[0]}, {-b[1], b[0], 0}});
+	
+	EXPECT_EQ(Mat3(FSLinalg::skew(a)), Sa);
+	EXPECT_EQ(FSLinalg::RealRowVector<3>(FSLinalg::skew(a)*b), FSLinalg::RealRowVector<3>(FSLinalg::cross(a, b)));
+	
+	const auto expr = FSLinalg::skew(a)*R*FSLinalg::skew(b)*v;
+	
+	using ProdAnalyzer = FSLinalg::MatrixProductAnalyzer<std::decay_t<decltype(expr)>>;
+	using SkewArray    = typename ProdAnalyzer::SkewArray;
+	
+	EXPECT_EQ(ProdAnalyzer::getSkewFactors(), SkewArray({true, false, true, false}));
+	
+	// two cross products and a mat-vec
+	EXPECT_EQ(ProdAnalyzer::getOptimalCost(), 6 + 9 + 6);
+	
+	const FSLinalg::RealRowVector<3> expected = Sa*(R*(Sb*v));
+	EXPECT_EQ(FSLinalg::RealRowVector<3>(expr), expected);
+	
+	// transposed, scaled and accumulated skew factors
+	FSLinalg::RealMatrix<3,3> M = R*FSLinalg::skew(a);
+	EXPECT_EQ(M, Mat3(R*Sa));
+	
+	M += 2.*FSLinalg::transpose(FSLinalg::skew(a))*R;
+	EXPECT_EQ(M, Mat3(R*Sa - 2.*Sa*R));
+	
+	M -= FSLinalg::skew(a)*FSLinalg::skew(b);
+	EXPECT_EQ(M, Mat3(R*Sa - 2.*Sa*R - Sa*Sb));
+}
+
+TEST(chain, kronecker)
+{
+	using Mat6  = FSLinalg::RealMatrix<6,6>;
+	using Mat64 = FSLinalg::RealMatrix<6,4>;
+	using Mat46 = FSLinalg::RealMatrix<4,6>;
+	
+	const FSLinalg::RealMatrix<2,3> A({{1, -2, 3}, {0, 4, -1}});
+	const FSLinalg::RealMatrix<3,2> B({{2, 1}, {-1, 3}, {5, 0}});
+	const FSLinalg::RealMatrix<3,2> C({{1, 0}, {2, -1}, {0, 3}});
+	const FSLinalg::RealMatrix<2,3> D({{-1, 2, 1}, {1, 1, 0}});
+	
+	const FSLinalg::RealRowVector<6> x({1, -1, 2, 0, 3, -2});
+	const Mat64 X({{1, 2, 0, -1}, {3, -1, 2, 0}, {0, 1, 1, 2}, {-2, 0, 1, 1}, {1, 1, -1, 0}, {2, 0, 3, -3}});
+	const Mat46 M = FSLinalg::transpose(X);
+	
+	// random access expands the Kronecker product
+	const Mat6 K = FSLinalg::kron(A, B);
+	for (unsigned int i=0; i!=6; ++i)
+	{
+		for (unsigned int j=0; j!=6; ++j) { EXPECT_EQ(K(i,j), A(i/3, j/2)*B(i%3, j%2)); }
+	}
+	
+	// products are computed factor by factor
+	EXPECT_EQ(FSLinalg::RealRowVector<6>(FSLinalg::kron(A, B)*x), FSLinalg::RealRowVector<6>(K*x));
+	EXPECT_EQ(Mat64(FSLinalg::kron(A, B)*X), Mat64(K*X));
+	EXPECT_EQ(Mat64(FSLinalg::kron(A, B)*FSLinalg::transpose(M)), Mat64(K*X));
+	EXPECT_EQ(Mat64(FSLinalg::transpose(FSLinalg::kron(A, B))*X), Mat64(FSLinalg::transpose(K)*X));
+	EXPECT_EQ(Mat46(M*FSLinalg::kron(A, B)), Mat46(M*K));
+	EXPECT_EQ(Mat46(FSLinalg::transpose(X)*FSLinalg::transpose(FSLinalg::kron(A, B))), Mat46(M*FSLinalg::transpose(K)));
+	EXPECT_EQ(Mat6(FSLinalg::kron(A, B)*FSLinalg::kron(C, D)), Mat6(K*Mat6(FSLinalg::kron(C, D))));
+	
+	// factors whose inner dimensions do not match: the rhs is expanded
+	const FSLinalg::RealMatrix<2,2> E({{1, 2}, {-1, 3}});
+	const FSLinalg::RealMatrix<3,3> F({{2, 0, 1}, {1, -1, 0}, {0, 3, 1}});
+	const Mat6 KEF = FSLinalg::kron(E, F);
+	const Mat6 KFE = FSLinalg::kron(F, E);
+	EXPECT_EQ(Mat6(FSLinalg::kron(E, F)*FSLinalg::kron(F, E)), Mat6(KEF*KFE));
+	EXPECT_EQ(Mat6(FSLinalg::transpose(FSLinalg::kron(E, F))*FSLinalg::kron(F, E)), Mat6(FSLinalg::transpose(KEF)*KFE));
+	
+	using MisalignedAnalyzer = FSLinalg::MatrixProductAnalyzer<std::decay_t<decltype(FSLinalg::kron(E, F)*FSLinalg::kron(F, E))>>;
+	// 6 columns of the factored mat-vec (2*2*3 + 2*3*3 = 30) plus the 36 entries of the expanded rhs
+	EXPECT_EQ(MisalignedAnalyzer::getOptimalCost(), 6*30 + 36);
+	
+	// in a longer chain, the misaligned pair is more expensive than applying both factored products to X in turn
+	const Mat6 X6 = Mat6::random();
+	const auto misalignedChain = FSLinalg::kron(E, F)*FSLinalg::kron(F, E)*X6;
+	
+	using MisalignedChainAnalyzer = FSLinalg::MatrixProductAnalyzer<std::decay_t<decltype(misalignedChain)>>;
+	EXPECT_EQ(MisalignedChainAnalyzer::getOptimalCost(), 6*30 + 6*30);
+	EXPECT_EQ(MisalignedChainAnalyzer::getOptimalSplit(), 1u);
+	
+	const Mat6 chainResult = misalignedChain;
+	const Mat6 expected    = KEF*Mat6(KFE*X6);
+	for (unsigned int i=0; i!=36; ++i) { EXPECT_NEAR(chainResult[i], expected[i], 1e-12); }
+	
+	// scaled, accumulated and aliased products
+	Mat64 Y = 2.*FSLinalg::kron(A, B)*X;
+	Y -= FSLinalg::kron(A, B)*X;
+	EXPECT_EQ(Y, Mat64(K*X));
+	
+	FSLinalg::RealRowVector<6> y = x;
+	y = FSLinalg::kron(A, B)*y;
+	EXPECT_EQ(y, FSLinalg::RealRowVector<6>(K*x));
+	
+	// complex factors, adjoint
+	using Cpx = std::complex<double>;
+	FSLinalg::CpxMatrix<2,2> Ac(0.);
+	FSLinalg::CpxMatrix<2,2> Bc(0.);
+	FSLinalg::CpxRowVector<4> xc(0.);
+	for (unsigned int i=0; i!=4; ++i)
+	{
+		Ac[i] = Cpx(i, 1. - i);
+		Bc[i] = Cpx(2. - i, i*i);
+		xc[i] = Cpx(1. + i, -1.);
+	}
+	const FSLinalg::CpxMatrix<4,4>  Kc = FSLinalg::kron(Ac, Bc);
+	const FSLinalg::CpxRowVector<4> yc = FSLinalg::adjoint(FSLinalg::kron(Ac, Bc))*xc;
+	EXPECT_EQ(yc, FSLinalg::CpxRowVector<4>(FSLinalg::adjoint(Kc)*xc));
+	
+	// the chain optimizer costs the Kronecker product at its factored complexity
+	const auto expr = M*FSLinalg::kron(A, B)*x;
+	
+	using ProdAnalyzer = FSLinalg::MatrixProductAnalyzer<std::decay_t<decltype(expr)>>;
+	using KronArray    = typename ProdAnalyzer::KronArray;
+	
+	EXPECT_EQ(ProdAnalyzer::getKroneckerFactors(), KronArray({{{0, 0}, {2, 3}, {0, 0}}}));
+	
+	// 24 for the factored mat-vec instead of 36, then 24 for the mat-vec by M
+	EXPECT_EQ(ProdAnalyzer::getOptimalCost(), 24 + 24);
+	EXPECT_EQ(FSLinalg::RealRowVector<4>(expr), FSLinalg::RealRowVector<4>(M*(K*x)));
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Dual.hpp>
+#include <FSLinalg/BasicLinalg/InnerProduct.hpp>
+#include <FSLinalg/BasicLinalg/Norm.hpp>
+#include <FSLinalg/BasicLinalg/TripleProduct.hpp>
+
+#include <fmt/format.h>
+
+using Dual2 = FSLinalg::Dual<double, 2>;
+using Dual3 = FSLinalg::Dual<double, 3>;
+
+TEST(dual, scalar)
+{
+	const Dual2 x = Dual2::variable(2., 0);
+	const Dual2 y = Dual2::variable(3., 1);
+	
+	const Dual2 f = x*x*y + sin(y)/x - 1.;
+	
+	EXPECT_DOUBLE_EQ(f.value,   12. + std::sin(3.)/2. - 1.);
+	EXPECT_DOUBLE_EQ(f.grad[0], 12. - std::sin(3.)/4.);
+	EXPECT_DOUBLE_EQ(f.grad[1],  4. + std::cos(3.)/2.);
+	
+	const Dual2 g = sqrt(exp(2.*log(x)));
+	EXPECT_DOUBLE_EQ(g.value,   2.);
+	EXPECT_DOUBLE_EQ(g.grad[0], 1.);
+	EXPECT_DOUBLE_EQ(g.grad[1], 0.);
+	
+	EXPECT_EQ(abs(-x).grad[0], 1.);
+	EXPECT_EQ(FSLinalg::abs2(y).grad[1], 6.);
+	EXPECT_EQ(FSLinalg::conj(y), y);
+	EXPECT_EQ((FSLinalg::BasicLinalg::TripleProduct<true,false,true>()(x, y, 2.)), 2.*x*y);
+	
+	EXPECT_TRUE((FSLinalg::IsRealScalar<Dual2>::value));
+	EXPECT_EQ(fmt::format("{}", y), "3 [0, 1]");
+}
+
+TEST(dual, jacobian)
+{
+	const FSLinalg::RealMatrix<2,3> A = FSLinalg::RealMatrix<2,3>::random();
+	const FSLinalg::RealMatrix<3,1> x = FSLinalg::RealMatrix<3,1>::random();
+	
+	const auto xd = FSLinalg::makeVariables<3>(x);
+	
+	// d(A*x)/dx = A
+	const FSLinalg::Matrix<Dual3,2,1> y = A*xd;
+	const FSLinalg::RealMatrix<2,1> expected = A*x;
+	const FSLinalg::RealMatrix<2,1> values   = FSLinalg::values(y);
+	for (unsigned int i=0; i!=2; ++i) { EXPECT_DOUBLE_EQ(values[i], expected[i]); }
+	
+	const FSLinalg::RealMatrix<2,3> J = FSLinalg::jacobian(y);
+	for (unsigned int i=0; i!=6; ++i) { EXPECT_DOUBLE_EQ(J[i], A[i]); }
+	
+	// d(x^T x)/dx = 2 x and d|x|/dx = x/|x|
+	const Dual3 s = FSLinalg::squaredNorm(xd);
+	const Dual3 n = FSLinalg::norm(xd);
+	const Dual3 p = FSLinalg::inner(xd, xd);
+	for (unsigned int i=0; i!=3; ++i) 
+	{ 
+		EXPECT_DOUBLE_EQ(s.grad[i], 2.*x[i]); 
+		EXPECT_DOUBLE_EQ(p.grad[i], 2.*x[i]); 
+		EXPECT_DOUBLE_EQ(n.grad[i], x[i]/n.value); 
+	}
+}
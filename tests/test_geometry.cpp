@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Geometry.hpp>
+#include <FSLinalg/BasicLinalg/Norm.hpp>
+
+#include <numbers>
+#include <vector>
+
+namespace
+{
+
+template<class Lhs, class Rhs>
+double maxAbsDiff(const FSLinalg::MatrixBase<Lhs>& lhs, const FSLinalg::MatrixBase<Rhs>& rhs)
+{
+	const FSLinalg::RealMatrix<Lhs::nRows, Lhs::nCols> diff = lhs - rhs;
+	
+	double ret = 0.;
+	for (unsigned int i=0; i!=diff.size; ++i) { ret = std::max(ret, std::abs(diff[i])); }
+	return ret;
+}
+
+} // namespace
+
+TEST(geometry, quaternion)
+{
+	using Quat = FSLinalg::Quaternion<double>;
+	using Vec  = FSLinalg::RealRowVector<3>;
+	using Mat  = FSLinalg::RealMatrix<3,3>;
+	
+	const Vec ez({0, 0, 1});
+	const Vec v({1, 2, 3});
+	
+	// quarter turn around z
+	const Quat q = Quat::fromAxisAngle(2.*ez, std::numbers::pi/2.);
+	
+	EXPECT_NEAR(q.norm(), 1., 1e-15);
+	EXPECT_LT(maxAbsDiff(q.rotate(v), Vec({-2, 1, 3})), 1e-15);
+	EXPECT_LT(maxAbsDiff(q.toMatrix(), Mat({{0, -1, 0}, {1, 0, 0}, {0, 0, 1}})), 1e-15);
+	EXPECT_LT(maxAbsDiff(q.toMatrix()*v, q.rotate(v)), 1e-15);
+	
+	// composition matches the matrix product, the inverse undoes the rotation
+	const Quat p = Quat::fromAxisAngle(Vec({1, -1, 2}), 0.7);
+	
+	EXPECT_LT(maxAbsDiff((p*q).toMatrix(), p.toMatrix()*q.toMatrix()), 1e-14);
+	EXPECT_LT(maxAbsDiff(p.inverse().rotate(p.rotate(v)), v), 1e-14);
+	
+	// round trip through the matrix, for every pivot of Shepperd's method
+	for (const Quat& r : {p, q, Quat(0.1, 0.9, 0.3, -0.2).normalized(), Quat(0.1, 0.3, 0.9, -0.2).normalized(), Quat(0.1, -0.2, 0.3, 0.9).normalized()})
+	{
+		Quat s = Quat::fromMatrix(r.toMatrix());
+		if (FSLinalg::dot(s, r) < 0.) { s = -s; }
+		
+		EXPECT_NEAR(s.w, r.w, 1e-14);
+		EXPECT_NEAR(s.x, r.x, 1e-14);
+		EXPECT_NEAR(s.y, r.y, 1e-14);
+		EXPECT_NEAR(s.z, r.z, 1e-14);
+	}
+}
+
+TEST(geometry, interpolation)
+{
+	using Quat = FSLinalg::Quaternion<double>;
+	using Vec  = FSLinalg::RealRowVector<3>;
+	
+	const Vec axis({1, 2, -1});
+	
+	const Quat a = Quat::fromAxisAngle(axis, 0.2);
+	const Quat b = Quat::fromAxisAngle(axis, 1.4);
+	
+	// slerp has a constant angular velocity around a common axis
+	const Quat c = FSLinalg::slerp(a, b, 0.25);
+	const Quat d = Quat::fromAxisAngle(axis, 0.5);
+	
+	EXPECT_NEAR(c.w, d.w, 1e-14);
+	EXPECT_NEAR(c.x, d.x, 1e-14);
+	EXPECT_NEAR(c.y, d.y, 1e-14);
+	EXPECT_NEAR(c.z, d.z, 1e-14);
+	
+	// both take the shortest path
+	const Quat e = FSLinalg::slerp(a, -b, 0.25);
+	EXPECT_NEAR(std::abs(FSLinalg::dot(e, d)), 1., 1e-14);
+	
+	const Quat f = FSLinalg::nlerp(a, -b, 0.5);
+	EXPECT_NEAR(f.norm(), 1., 1e-15);
+	EXPECT_NEAR(FSLinalg::dot(f, Quat::fromAxisAngle(axis, 0.8)), 1., 1e-14);
+	
+	EXPECT_EQ(FSLinalg::slerp(a, a, 0.3), FSLinalg::nlerp(a, a, 0.3));
+}
+
+TEST(geometry, rotation)
+{
+	using Quat = FSLinalg::Quaternion<double>;
+	using Rot  = FSLinalg::Rotation3<double>;
+	using Vec  = FSLinalg::RealRowVector<3>;
+	using Mat  = FSLinalg::RealMatrix<3,3>;
+	
+	static_assert(sizeof(Rot) == 4*sizeof(double));
+	
+	const Rot R = Rot::fromAxisAngle(Vec({0, 1, 1}), 0.3);
+	const Rot S = Rot(Quat(0.5, 0.5, -0.5, 0.5));
+	const Mat A = Mat::random();
+	const Vec v({1, 2, 3});
+	
+	const Mat MR = R.toMatrix();
+	const Mat MS = S.toMatrix();
+	
+	EXPECT_LT(maxAbsDiff(R, MR), 1e-15);
+	EXPECT_LT(maxAbsDiff(R*v, MR*v), 1e-15);
+	EXPECT_LT(maxAbsDiff(A*R*S*v, A*MR*MS*v), 1e-14);
+	EXPECT_LT(maxAbsDiff(FSLinalg::transpose(R)*v, R.inverse()*v), 1e-15);
+	EXPECT_LT(maxAbsDiff(Rot(R*S), MR*MS), 1e-15);
+	EXPECT_LT(maxAbsDiff(Rot(MR), MR), 1e-15);
+	
+	Mat B = A;
+	B += 2.*R;
+	B -= S;
+	EXPECT_LT(maxAbsDiff(B, A + 2.*MR - MS), 1e-15);
+}
+
+TEST(geometry, batched_rotation)
+{
+	using Quat = FSLinalg::Quaternion<double>;
+	using Vec  = FSLinalg::RealRowVector<3>;
+	
+	std::vector<Quat> q;
+	std::vector<Vec>  v;
+	for (unsigned int p=0; p!=37; ++p)
+	{
+		q.push_back(Quat::fromAxisAngle(Vec::random(), 0.1*double(p)));
+		v.push_back(Vec::random());
+	}
+	
+	std::vector<Vec> out(v.size(), Vec(0.));
+	
+	FSLinalg::rotate(q[3], std::span<const Vec>(v), std::span<Vec>(out));
+	for (unsigned int p=0; p!=v.size(); ++p) { EXPECT_LT(maxAbsDiff(out[p], q[3].rotate(v[p])), 1e-15); }
+	
+	FSLinalg::rotate(std::span<const Quat>(q), std::span<const Vec>(v), std::span<Vec>(out));
+	for (unsigned int p=0; p!=v.size(); ++p) { EXPECT_LT(maxAbsDiff(out[p], q[p].rotate(v[p])), 1e-15); }
+}
+
+TEST(geometry, lie_group)
+{
+	using Vec = FSLinalg::RealRowVector<3>;
+	using Mat = FSLinalg::RealMatrix<3,3>;
+	
+	for (const double scale : {1e-9, 1e-3, 0.5, 3.})
+	{
+		const Vec omega = scale*Vec({0.3, -0.8, 0.5});
+		
+		const Mat R = FSLinalg::expSO3(omega);
+		
+		EXPECT_LT(maxAbsDiff(R, FSLinalg::Rotation3<double>::fromAxisAngle(omega, FSLinalg::norm(omega)).toMatrix()), 1e-15);
+		EXPECT_LT(maxAbsDiff(R, FSLinalg::exp(Mat(FSLinalg::skew(omega)))), 1e-14);
+		EXPECT_LT(maxAbsDiff(FSLinalg::exp(FSLinalg::skew(omega)), R), 1e-15);
+		EXPECT_LT(maxAbsDiff(FSLinalg::logSO3(R), omega), 1e-14);
+		
+		// the twist exponential agrees with the exponential of the 4x4 generator
+		const Vec v({1, -2, 0.5});
+		
+		FSLinalg::RealMatrix<4,4> xi(0.);
+		const Mat K(FSLinalg::skew(omega));
+		for (unsigned int i=0; i!=3; ++i)
+		{
+			for (unsigned int j=0; j!=3; ++j) { xi(i,j) = K(i,j); }
+			xi(i,3) = v[i];
+		}
+		
+		EXPECT_LT(maxAbsDiff(FSLinalg::expSE3(omega, v), FSLinalg::exp(xi)), 1e-13);
+	}
+	
+	// log at a half turn
+	const Vec halfTurn({0, std::numbers::pi, 0});
+	EXPECT_LT(maxAbsDiff(FSLinalg::log(FSLinalg::Rotation3<double>(FSLinalg::expSO3(halfTurn))), halfTurn), 1e-7);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/HalfFloat.hpp>
+#include <FSLinalg/HalfFloatFormater.hpp>
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/BasicLinalg/InnerProduct.hpp>
+
+#include <fmt/format.h>
+
+using Half  = FSLinalg::SoftwareFloat16;
+using BHalf = FSLinalg::SoftwareBFloat16;
+
+TEST(half_float, rounding)
+{
+	// ties go to even
+	EXPECT_EQ(float(Half(1.f + 0x1p-11f)),   1.f);
+	EXPECT_EQ(float(Half(1.f + 0x3p-11f)),   1.f + 0x1p-9f);
+	EXPECT_EQ(float(BHalf(1.f + 0x1p-8f)),   1.f);
+	EXPECT_EQ(float(BHalf(1.f + 0x3p-8f)),   1.f + 0x1p-6f);
+	
+	// range
+	EXPECT_EQ(float(Half(65504.f)), 65504.f);
+	EXPECT_EQ(float(Half(65519.f)), 65504.f);
+	EXPECT_EQ(float(Half(65520.f)), std::numeric_limits<float>::infinity());
+	EXPECT_EQ(float(Half(-0x1p-24f)), -0x1p-24f);
+	EXPECT_EQ(float(Half(0x1p-25f)), 0.f);
+	EXPECT_TRUE(std::isnan(float(Half(std::numeric_limits<float>::quiet_NaN()))));
+	
+	EXPECT_EQ(float(FSLinalg::NumTraits<Half>::epsilon),  0x1p-10f);
+	EXPECT_EQ(float(FSLinalg::NumTraits<BHalf>::epsilon), 0x1p-7f);
+	EXPECT_EQ(float(FSLinalg::NumTraits<BHalf>::max), std::bit_cast<float>(0x7F7F0000u));
+}
+
+#if defined(__FLT16_MAX__)
+TEST(half_float, matches_native)
+{
+	for (std::uint32_t bits=0; bits!=0x10000u; ++bits)
+	{
+		const float expected = float(std::bit_cast<_Float16>(std::uint16_t(bits)));
+		
+		if (std::isnan(expected)) { continue; }
+		
+		const float value = float(Half::fromBits(std::uint16_t(bits)));
+		
+		ASSERT_EQ(value, expected);
+		
+		// halfway to the next value
+		const float next    = float(std::bit_cast<_Float16>(std::uint16_t(bits + 1)));
+		const float halfway = value + (next - value)/2;
+		if (not std::isnan(halfway) and std::isfinite(next))
+		{
+			ASSERT_EQ(Half(halfway).bits, std::bit_cast<std::uint16_t>(_Float16(halfway)));
+		}
+	}
+}
+#endif
+
+TEST(half_float, matrix)
+{
+	using FloatMatrix = FSLinalg::Matrix<float,2,2>;
+	using HalfMatrix  = FSLinalg::Matrix<Half,2,2>;
+	
+	const FloatMatrix A({{1, 2}, {3, 4}});
+	const FloatMatrix B({{0.5, -1}, {2, 0.25}});
+	
+	const HalfMatrix HA(FSLinalg::cast<Half>(A));
+	const HalfMatrix HB(FSLinalg::cast<Half>(B));
+	
+	// accumulation happens in float
+	using Accumulator = FSLinalg::AccumulatorTraits<Half>::Type;
+	static_assert(std::is_same<Accumulator, float>::value);
+	
+	EXPECT_EQ(FloatMatrix(FSLinalg::cast<float>(HA*HB)), FloatMatrix(A*B));
+	EXPECT_EQ(FloatMatrix(FSLinalg::cast<float>(HA + HB)), FloatMatrix(A + B));
+	
+	const FSLinalg::Matrix<Half,2049,1> x(Half(1));
+	
+	// 2049 is not representable in half precision, but is in the float accumulator
+	EXPECT_EQ(FSLinalg::inner(x, x), 2049.f);
+	
+	const FSLinalg::Matrix<FSLinalg::float16,2,2> NA(FSLinalg::cast<FSLinalg::float16>(A));
+	EXPECT_EQ(FloatMatrix(FSLinalg::cast<float>(NA*NA)), FloatMatrix(A*A));
+	
+	EXPECT_EQ(fmt::format("{}", BHalf(1.5f)), "1.5");
+	EXPECT_EQ(fmt::format("{}", HA), fmt::format("{}", A));
+}
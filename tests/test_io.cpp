@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Tensor.hpp>
+#include <FSLinalg/IO.hpp>
+
+#include <fmt/format.h>
+
+#include <complex>
+#include <cstdlib>
+#include <filesystem>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+// removes the file when going out of scope
+struct TemporaryFile
+{
+	explicit TemporaryFile(const char* name) : path(std::filesystem::temp_directory_path() / name) {}
+	~TemporaryFile() { std::filesystem::remove(path); }
+	
+	std::filesystem::path path;
+};
+
+} // namespace
+
+TEST(io, matrix)
+{
+	using Mat = FSLinalg::RealMatrix<3,2>;
+	
+	const TemporaryFile file("fslinalg_test_io_matrix.bin");
+	
+	std::vector<Mat> records;
+	for (unsigned int n=0; n!=5; ++n) { records.push_back(Mat::random()); }
+	
+	const FSLinalg::RealMatrix<3,3> A = FSLinalg::RealMatrix<3,3>::random();
+	
+	{
+		FSLinalg::IO::BinaryWriter<Mat> writer(file.path);
+		writer.write(records[0]);
+		writer.write(std::span<const Mat>(records).subspan(1));
+		writer.write(A*records[4]);
+		EXPECT_EQ(writer.size(), 6u);
+		writer.close();
+	}
+	
+	const FSLinalg::IO::BinaryReader<Mat> reader(file.path);
+	ASSERT_EQ(reader.size(), 6u);
+	EXPECT_EQ(reader.header().rank, 2u);
+	EXPECT_EQ(reader.header().shape[0], 3u);
+	EXPECT_EQ(reader.header().shape[1], 2u);
+	
+	for (unsigned int n=0; n!=5; ++n) { EXPECT_EQ(reader[n], records[n]); }
+	EXPECT_EQ(reader[5], Mat(A*records[4]));
+	
+	// views are read-only leaves of expressions, and products operands
+	const Mat sum = 2.*reader[0] - reader[1];
+	EXPECT_EQ(sum, Mat(2.*records[0] - records[1]));
+	EXPECT_EQ(Mat(A*reader[2]), Mat(A*records[2]));
+	
+	// a file holding other records is rejected
+	using TransposedReader = FSLinalg::IO::BinaryReader<FSLinalg::RealMatrix<2,3>>;
+	using FloatReader      = FSLinalg::IO::BinaryReader<FSLinalg::Matrix<float,3,2>>;
+	EXPECT_THROW(TransposedReader{file.path}, std::runtime_error);
+	EXPECT_THROW(FloatReader{file.path},      std::runtime_error);
+}
+
+TEST(io, tensor)
+{
+	using Tens = FSLinalg::Tensor<float,2,3,4>;
+	
+	const TemporaryFile file("fslinalg_test_io_tensor.bin");
+	
+	std::vector<Tens> records;
+	for (unsigned int n=0; n!=3; ++n) { records.push_back(Tens::random()); }
+	
+	{
+		FSLinalg::IO::BinaryWriter<Tens> writer(file.path);
+		writer.write(std::span<const Tens>(records));
+		writer.write(2.f*records[0]);
+	}
+	
+	const FSLinalg::IO::BinaryReader<Tens> reader(file.path);
+	ASSERT_EQ(reader.size(), 4u);
+	EXPECT_EQ(reader.header().rank, 3u);
+	
+	for (unsigned int n=0; n!=3; ++n) { EXPECT_TRUE(reader[n] == records[n]); }
+	EXPECT_EQ(reader[3](1u,2u,3u), 2.f*records[0](1u,2u,3u));
+	
+	const Tens diff = reader[3] - 2.f*reader[0];
+	EXPECT_TRUE(diff == Tens(0.f));
+}
+
+TEST(io, chunked)
+{
+	using Vec = FSLinalg::RealRowVector<4>;
+	
+	const TemporaryFile file("fslinalg_test_io_chunked.bin");
+	
+	constexpr unsigned int n = 10;
+	{
+		FSLinalg::IO::BinaryWriter<Vec> writer(file.path);
+		for (unsigned int k=0; k!=n; ++k) { writer.write(Vec({double(k), 1., 2., 3.})); }
+	}
+	
+	FSLinalg::IO::BinaryChunkReader<Vec> reader(file.path, 3);
+	EXPECT_EQ(reader.totalSize(), n);
+	
+	unsigned int nChunks = 0;
+	unsigned int nRead   = 0;
+	while (reader.next())
+	{
+		EXPECT_EQ(reader.offset(), nRead);
+		for (unsigned int k=0; k!=reader.size(); ++k) { EXPECT_EQ(reader[k][0], double(nRead + k)); }
+		nRead += unsigned(reader.size());
+		++nChunks;
+	}
+	EXPECT_EQ(nRead, n);
+	EXPECT_EQ(nChunks, 4u);
+	EXPECT_FALSE(reader.next());
+}
+
+TEST(io, format_spec)
+{
+	const FSLinalg::RealMatrix<2,2> A({{1., 2.5}, {-3., 4.}});
+	
+	// default output and scalar specs are unchanged
+	EXPECT_EQ(fmt::format("{}", A), "[[1, 2.5]\n[-3, 4]]");
+	EXPECT_EQ(fmt::format("{}", 2.*A), "[[2, 5]\n[-6, 8]]");
+	EXPECT_EQ(fmt::format("{}", FSLinalg::Matrix<float,1,2>({{0.1f, 1e10f}})), "[0.1, 10000000000]");
+	EXPECT_EQ(fmt::format("{}", FSLinalg::RealColVector<2>({1./3., 5e300})), "[0.3333333333333333, 5e+300]");
+	EXPECT_EQ(fmt::format("{:.2f}", A), "[[1.00, 2.50]\n[-3.00, 4.00]]");
+	EXPECT_EQ(fmt::format("{:>4}", FSLinalg::RealColVector<2>({1., 2.})), "[   1,    2]");
+	
+	// layout options, ended by '|'
+	EXPECT_EQ(fmt::format("{:c|}", A), "[[1, -3]\n[2.5, 4]]");
+	EXPECT_EQ(fmt::format("{:s; |.1f}", A), "[[1.0; 2.5]\n[-3.0; 4.0]]");
+	EXPECT_EQ(fmt::format("{:cs |}", A), "[[1 -3]\n[2.5 4]]");
+	EXPECT_EQ(fmt::format("{:s,|}", FSLinalg::RealRowVector<3>({1., 2., 3.})), "[1,2,3]^T");
+	
+	const FSLinalg::Tensor<double,3> t({1., 2., 3.});
+	EXPECT_EQ(fmt::format("{:s |.1f}", t), fmt::format("{:s |.1f}", FSLinalg::RealColVector<3>({1., 2., 3.})));
+}
+
+TEST(io, text_export)
+{
+	using Mat = FSLinalg::RealMatrix<2,2>;
+	
+	std::ostringstream stream;
+	{
+		// a tiny threshold flushes after every record
+		FSLinalg::IO::TextExporter exporter(stream, ",", 8);
+		const std::vector<Mat> records = {Mat({{1., 0.1}, {-2.5, 1e300}}), Mat({{0., 3.}, {4., 5.}})};
+		exporter.write(std::span<const Mat>(records));
+		exporter.write(FSLinalg::Tensor<int,2,2>({{1, 2}, {3, 4}}));
+		exporter.write(FSLinalg::Matrix<std::complex<double>,1,2>({{std::complex<double>(1., 2.), std::complex<double>(-3., 0.5)}}));
+	}
+	EXPECT_EQ(stream.str(), "1,0.1,-2.5,1e+300\n0,3,4,5\n1,2,3,4\n1,2,-3,0.5\n");
+	
+	// the shortest representation reads back exactly, and the buffer is flushed on destruction only
+	std::ostringstream exact;
+	const Mat B = Mat::random();
+	{
+		FSLinalg::IO::TextExporter exporter(exact, "\t");
+		exporter.write(FSLinalg::transpose(B));
+		EXPECT_TRUE(exact.str().empty());
+	}
+	
+	const std::string text = exact.str();
+	const char* it = text.c_str();
+	for (unsigned int j=0; j!=2; ++j)
+	{
+		for (unsigned int i=0; i!=2; ++i)
+		{
+			char* end = nullptr;
+			EXPECT_EQ(std::strtod(it, &end), B(i,j));
+			it = end + 1;
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Pack.hpp>
+#include <FSLinalg/Tensor.hpp>
+#include <FSLinalg/BasicLinalg/InnerProduct.hpp>
+#include <FSLinalg/BasicLinalg/Norm.hpp>
+
+#include <fmt/format.h>
+
+using Pack4 = FSLinalg::Pack<double, 4>;
+
+TEST(pack, scalar)
+{
+	const Pack4 a = Pack4::load(std::array<double,4>{1., -2., 3., -4.}.data());
+	const Pack4 b = 2.;
+	
+	const Pack4 c = a*b + 1.;
+	EXPECT_EQ(c[0], 3.);
+	EXPECT_EQ(c[3], -7.);
+	EXPECT_EQ(abs(a)[1], 2.);
+	EXPECT_EQ(FSLinalg::abs2(a)[3], 16.);
+	EXPECT_EQ(max(a, b)[2], 3.);
+	
+	const auto mask = a < b;
+	EXPECT_TRUE(mask[0] and mask[1] and not mask[2] and mask[3]);
+	EXPECT_TRUE(any(mask));
+	EXPECT_FALSE(all(mask));
+	EXPECT_TRUE(all(a == a));
+	EXPECT_EQ(select(mask, a, b)[2], 2.);
+	EXPECT_EQ(reduceAdd(a), -2.);
+	
+	EXPECT_TRUE(FSLinalg::IsRealScalar<Pack4>::value);
+	EXPECT_EQ(fmt::format("{}", a), "(1, -2, 3, -4)");
+}
+
+TEST(pack, matrix)
+{
+	using Mat = FSLinalg::RealMatrix<3,3>;
+	using Vec = FSLinalg::RealMatrix<3,1>;
+	
+	std::array<Mat,4> A, B;
+	std::array<Vec,4> x;
+	for (unsigned int k=0; k!=4; ++k)
+	{
+		A[k] = Mat::random();
+		B[k] = Mat::random();
+		x[k] = Vec::random();
+	}
+	
+	const auto Ap = FSLinalg::pack(A);
+	const auto Bp = FSLinalg::pack(B);
+	const auto xp = FSLinalg::pack(x);
+	
+	// each lane goes through the same kernel as the scalar version
+	const FSLinalg::Matrix<Pack4,3,3> Cp = Ap*Bp + Bp;
+	const FSLinalg::Matrix<Pack4,3,1> yp = Ap*xp;
+	const Pack4 n = FSLinalg::squaredNorm(xp);
+	const Pack4 p = FSLinalg::inner(xp, yp);
+	
+	for (unsigned int k=0; k!=4; ++k)
+	{
+		const Mat C = A[k]*B[k] + B[k];
+		const Vec y = A[k]*x[k];
+		
+		EXPECT_EQ(FSLinalg::extractLane(Cp, k), C);
+		EXPECT_EQ(FSLinalg::extractLane(yp, k), y);
+		EXPECT_DOUBLE_EQ(n[k], FSLinalg::squaredNorm(x[k]));
+		EXPECT_DOUBLE_EQ(p[k], FSLinalg::inner(x[k], y));
+	}
+	
+	// equality holds only when every lane matches
+	EXPECT_TRUE(Cp == Cp);
+	FSLinalg::Matrix<Pack4,3,3> Dp = Cp;
+	Dp(1,2)[3] += 1.;
+	EXPECT_FALSE(Dp == Cp);
+}
+
+TEST(pack, tensor_comparison)
+{
+	using Tens = FSLinalg::Tensor<Pack4, 2, 2>;
+	
+	Tens a, b;
+	for (unsigned int i=0; i!=4; ++i)
+	{
+		a[i] = Pack4(double(i));
+		b[i] = Pack4(double(i));
+	}
+	b[3][1] = 10.;
+	
+	EXPECT_TRUE (FSLinalg::all(a <= b));
+	EXPECT_FALSE(FSLinalg::all(a < b));
+	EXPECT_TRUE (FSLinalg::any(a < b));
+	EXPECT_FALSE(FSLinalg::any(a > b));
+	EXPECT_FALSE(a == b);
+	EXPECT_TRUE (a == a);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Pack.hpp>
+#include <FSLinalg/Parallel/BatchEvaluate.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+TEST(parallel, thread_pool)
+{
+	FSLinalg::Parallel::ThreadPool pool(4);
+	EXPECT_EQ(pool.size(), 4u);
+	
+	std::vector<std::atomic<int>> counts(1000);
+	pool.parallelFor(counts.size(), [&](const std::size_t chunk) -> void 
+	{ 
+		++counts[chunk];
+		// nested loops run serially
+		pool.parallelFor(2, [&](const std::size_t) -> void {});
+	});
+	for (const std::atomic<int>& count : counts) { EXPECT_EQ(count.load(), 1); }
+	
+	EXPECT_THROW(pool.parallelFor(100, [](const std::size_t chunk) -> void { if (chunk == 42) { throw std::runtime_error("chunk"); } }), std::runtime_error);
+	
+	// the serial loop also runs every chunk before rethrowing
+	FSLinalg::Parallel::ThreadPool serialPool(1);
+	std::atomic<int> nRun = 0;
+	EXPECT_THROW(serialPool.parallelFor(100, [&](const std::size_t chunk) -> void { ++nRun; if (chunk == 42) { throw std::runtime_error("chunk"); } }), std::runtime_error);
+	EXPECT_EQ(nRun.load(), 100);
+}
+
+TEST(parallel, batch_evaluate)
+{
+	using Mat = FSLinalg::RealMatrix<3,3>;
+	using Vec = FSLinalg::RealMatrix<3,1>;
+	
+	constexpr std::size_t n = 20000;
+	
+	const Mat A = Mat::random();
+	std::vector<Vec> x(n), y(n);
+	for (Vec& xi : x) { xi = Vec::random(); }
+	
+	FSLinalg::Parallel::ThreadPool pool(4);
+	FSLinalg::Parallel::batchEvaluate(pool, [&](const Vec& xi) { return A*xi + xi; }, std::span<Vec>(y), std::span<const Vec>(x));
+	
+	for (std::size_t i=0; i!=n; ++i) 
+	{ 
+		const Vec expected = A*x[i] + x[i];
+		ASSERT_EQ(y[i], expected);
+	}
+	
+	// raw pointer ranges of scalars
+	std::vector<double> a(n), b(n);
+	for (std::size_t i=0; i!=n; ++i) { a[i] = double(i); }
+	FSLinalg::Parallel::batchEvaluate(pool, [](const double ai) { return 2.*ai; }, std::span<double>(b.data(), n), std::span<const double>(a.data(), n));
+	EXPECT_EQ(b[n-1], 2.*double(n-1));
+}
+
+TEST(parallel, batch_sum)
+{
+	using Vec  = FSLinalg::RealMatrix<3,1>;
+	using Pack = FSLinalg::Pack<double, 4>;
+	
+	constexpr std::size_t n = 50000;
+	
+	std::vector<Vec> x(n);
+	for (Vec& xi : x) { xi = Vec::random(); }
+	
+	FSLinalg::Parallel::ThreadPool serial(1), pool(3), other(8);
+	
+	const auto builder = [](const Vec& xi) { return 2.*xi; };
+	
+	// identical whatever the number of threads
+	const Vec sum1 = FSLinalg::Parallel::batchSum<Vec>(serial, builder, std::span<const Vec>(x));
+	const Vec sum3 = FSLinalg::Parallel::batchSum<Vec>(pool,   builder, std::span<const Vec>(x));
+	const Vec sum8 = FSLinalg::Parallel::batchSum<Vec>(other,  builder, std::span<const Vec>(x));
+	EXPECT_EQ(sum1, sum3);
+	EXPECT_EQ(sum1, sum8);
+	
+	Vec expected(0.);
+	for (const Vec& xi : x) { expected += 2.*xi; }
+	for (unsigned int i=0; i!=3; ++i) { EXPECT_NEAR(sum1[i], expected[i], 1e-9); }
+	
+	// lane-interleaved batches
+	std::vector< FSLinalg::Matrix<Pack,3,1> > packed(n/4);
+	for (std::size_t p=0; p!=n/4; ++p) { packed[p] = FSLinalg::pack(std::array<Vec,4>{x[4*p], x[4*p+1], x[4*p+2], x[4*p+3]}); }
+	
+	const auto packedSum = FSLinalg::Parallel::batchSum< FSLinalg::Matrix<Pack,3,1> >(pool, [](const FSLinalg::Matrix<Pack,3,1>& xp) { return 2.*xp; }, std::span<const FSLinalg::Matrix<Pack,3,1>>(packed));
+	for (unsigned int i=0; i!=3; ++i) { EXPECT_NEAR(reduceAdd(packedSum[i]), expected[i], 1e-9); }
+}
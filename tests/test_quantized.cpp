@@ -0,0 +1,59 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+
+using FloatMatrix = FSLinalg::Matrix<float,2,2>;
+using Int8Matrix  = FSLinalg::Int8Matrix<2,2>;
+using Int16Matrix = FSLinalg::Int16Matrix<2,2>;
+
+TEST(quantized, quantize)
+{
+	const FloatMatrix A({{1, -2}, {0.5, 3}});
+	const Int8Matrix QA(A, {.scale = 0.5f, .zeroPoint = 3});
+	
+	EXPECT_EQ(QA.getQuantized(0), 5);
+	EXPECT_EQ(QA.getQuantized(1), -1);
+	EXPECT_EQ(QA.getQuantized(2), 4);
+	EXPECT_EQ(QA.getQuantized(3), 9);
+	EXPECT_EQ(FloatMatrix(QA), A);
+	
+	// saturation
+	const Int8Matrix QS(1000.f*A, {.scale = 0.5f, .zeroPoint = 3});
+	EXPECT_EQ(QS.getQuantized(0), 127);
+	EXPECT_EQ(QS.getQuantized(1), -128);
+	
+	// 0 is always representable
+	const FSLinalg::Quantization q = Int8Matrix::fitRange(-1.f, 1.f);
+	const Int8Matrix QZ(FloatMatrix(0.f), q);
+	EXPECT_EQ(QZ, FloatMatrix(0.f));
+	EXPECT_EQ(q.zeroPoint, -1);
+}
+
+TEST(quantized, product)
+{
+	const FloatMatrix A({{1, -2}, {0.5, 3}});
+	const FloatMatrix B({{-1, 0.25}, {2, 4}});
+	
+	const Int8Matrix  QA(A, {.scale = 0.5f,  .zeroPoint = 3});
+	const Int8Matrix  QB(B, {.scale = 0.25f, .zeroPoint = -10});
+	const Int16Matrix WA(A, {.scale = 0.5f,  .zeroPoint = 1000});
+	const Int16Matrix WB(B, {.scale = 0.25f, .zeroPoint = 0});
+	
+	EXPECT_EQ(FloatMatrix(QA*QB), FloatMatrix(A*B));
+	EXPECT_EQ(FloatMatrix(FSLinalg::transpose(QA)*QB), FloatMatrix(FSLinalg::transpose(A)*B));
+	EXPECT_EQ(FloatMatrix(QA*FSLinalg::transpose(QB)), FloatMatrix(A*FSLinalg::transpose(B)));
+	EXPECT_EQ(FloatMatrix(2.f*QA*QB), FloatMatrix(2.f*A*B));
+	EXPECT_EQ(FloatMatrix(WA*WB), FloatMatrix(A*B));
+	
+	FloatMatrix C(QA*B);
+	EXPECT_EQ(C, FloatMatrix(A*B));
+	C += A*QB;
+	EXPECT_EQ(C, FloatMatrix(2.f*A*B));
+	
+	// requantization on store
+	const FSLinalg::Quantization qC = {.scale = 0.125f, .zeroPoint = -4};
+	const Int8Matrix QC(QA*QB, qC);
+	
+	EXPECT_EQ(QC, Int8Matrix(FloatMatrix(A*B), qC));
+	EXPECT_EQ(FloatMatrix(QC), FloatMatrix(A*B));
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+#include <FSLinalg/Tensor.hpp>
+#include <FSLinalg/Random.hpp>
+#include <FSLinalg/BasicLinalg/Norm.hpp>
+#include <FSLinalg/Parallel/BatchRandom.hpp>
+
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+TEST(random, philox)
+{
+	using Philox = FSLinalg::Philox4x32;
+	
+	// known answers of the Random123 reference implementation
+	EXPECT_EQ(Philox::block({0, 0, 0, 0}, {0, 0}), Philox::Counter({0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+	EXPECT_EQ(Philox::block({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}), Philox::Counter({0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+	EXPECT_EQ(Philox::block({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}), Philox::Counter({0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+	
+	// the lane-wise kernel gives the same blocks
+	Philox::Word words[4][8];
+	Philox::generate({0x12345678, 0x9abcdef0}, 7, 0xfffffffe, words);
+	for (unsigned int l=0; l!=8; ++l)
+	{
+		const std::uint64_t k = 0xfffffffeULL + l;
+		const Philox::Counter expected = Philox::block({Philox::Word(k), Philox::Word(k >> 32), 7, 0}, {0x12345678, 0x9abcdef0});
+		for (unsigned int w=0; w!=4; ++w) { EXPECT_EQ(words[w][l], expected[w]); }
+	}
+}
+
+TEST(random, engine)
+{
+	FSLinalg::RandomEngine a(42, 3), b(42, 3), c(42, 4);
+	
+	std::vector<std::uint32_t> words(10);
+	for (std::uint32_t& w : words) { w = a(); }
+	EXPECT_EQ(a.position(), 3u);
+	EXPECT_NE(words[0], c());
+	
+	b.discard(7);
+	EXPECT_EQ(b(), words[7]);
+	
+	// usable with the standard distributions
+	std::uniform_int_distribution<int> die(1, 6);
+	const int roll = die(a);
+	EXPECT_TRUE(roll >= 1 and roll <= 6);
+	
+	// fills start at the next unused block and are reproducible
+	FSLinalg::RandomEngine d(42, 3);
+	d.seek(a.position());
+	std::vector<double> x(5), y(5);
+	a.fillUniform(std::span<double>(x), -2., 3.);
+	d.fillUniform(std::span<double>(y), -2., 3.);
+	EXPECT_EQ(x, y);
+	EXPECT_EQ(a.position(), d.position());
+	for (const double xi : x) { EXPECT_TRUE(xi >= -2. and xi < 3.); }
+	
+	std::vector<float> z(1000);
+	a.fillNormal(std::span<float>(z), 1.f, 2.f);
+	double mean = 0.;
+	for (const float zi : z) { mean += double(zi); }
+	mean /= double(z.size());
+	EXPECT_NEAR(mean, 1., 0.25);
+}
+
+TEST(random, matrix)
+{
+	using Mat  = FSLinalg::RealMatrix<3,3>;
+	using Cpx  = FSLinalg::CpxMatrix<2,2>;
+	using Tens = FSLinalg::Tensor<float,2,3,4>;
+	
+	FSLinalg::RandomEngine a(1), b(1);
+	EXPECT_EQ(Mat::random(a), Mat::random(b));
+	EXPECT_TRUE(Tens::random(a, 0.f, 1.f) == Tens::random(b, 0.f, 1.f));
+	EXPECT_NE(Mat::random(), Mat::random());
+	
+	// real and imaginary parts are drawn independently
+	const Cpx Z = Cpx::random(a, 0., 1.);
+	for (unsigned int i=0; i!=Cpx::size; ++i) 
+	{ 
+		EXPECT_NE(Z[i].real(), Z[i].imag());
+		EXPECT_TRUE(Z[i].imag() >= 0. and Z[i].imag() < 1.);
+	}
+}
+
+TEST(random, batch)
+{
+	using Mat = FSLinalg::RealMatrix<3,3>;
+	using Cpx = FSLinalg::CpxMatrix<2,3>;
+	
+	constexpr std::size_t n = 10000;
+	
+	// same values as filling the items one after the other, whatever the number of threads
+	FSLinalg::RandomEngine sequential(5, 1);
+	std::vector<Mat> expected;
+	for (std::size_t i=0; i!=n; ++i) { expected.push_back(Mat::random(sequential, 0., 2.)); }
+	
+	for (const unsigned int nThreads : {1u, 3u, 4u})
+	{
+		FSLinalg::Parallel::ThreadPool pool(nThreads);
+		FSLinalg::RandomEngine engine(5, 1);
+		std::vector<Mat> x(n);
+		FSLinalg::Parallel::batchRandom(pool, engine, std::span<Mat>(x), 0., 2.);
+		EXPECT_EQ(x, expected);
+		EXPECT_EQ(engine.position(), sequential.position());
+	}
+	
+	FSLinalg::RandomEngine e1(9), e2(9);
+	std::vector<Cpx> z1(n, Cpx(0.)), z2(n, Cpx(0.));
+	FSLinalg::Parallel::batchRandomNormal(e1, std::span<Cpx>(z1));
+	for (Cpx& zi : z2) { e2.fillNormal(std::span<std::complex<double>>(zi.data(), Cpx::size)); }
+	EXPECT_EQ(z1, z2);
+	
+	double var = 0.;
+	for (const Cpx& zi : z1) { var += FSLinalg::squaredNorm(zi); }
+	var /= double(2*Cpx::size*n);
+	EXPECT_NEAR(var, 1., 0.05);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <FSLinalg/Matrix.hpp>
+
+using Cpx = std::complex<double>;
+
+TEST(split_complex, planes)
+{
+	using SplitMatrix = FSLinalg::SplitCpxMatrix<2,3>;
+	using CpxMatrix   = FSLinalg::CpxMatrix<2,3>;
+	
+	const CpxMatrix A({{Cpx(1, 2), Cpx(0, -1), Cpx(3, 0)}, {Cpx(-1, 1), Cpx(2, 2), Cpx(0, 4)}});
+	const SplitMatrix S(A);
+	
+	const FSLinalg::RealMatrix<2,3> expectedReal({{ 1,  0, 3}, {-1, 2, 0}});
+	const FSLinalg::RealMatrix<2,3> expectedImag({{ 2, -1, 0}, { 1, 2, 4}});
+	
+	EXPECT_EQ(S.getReal(), expectedReal);
+	EXPECT_EQ(S.getImag(), expectedImag);
+	EXPECT_EQ(S, A);
+	EXPECT_EQ(CpxMatrix(S), A);
+	EXPECT_EQ(SplitMatrix(FSLinalg::conj(A)), FSLinalg::conj(A));
+}
+
+TEST(split_complex, product)
+{
+	using SplitMatrix = FSLinalg::SplitCpxMatrix<3,3>;
+	using CpxMatrix   = FSLinalg::CpxMatrix<3,3>;
+	
+	const CpxMatrix A({{Cpx(1, 2), Cpx(0, -1), Cpx(3, 0)}, {Cpx(-1, 1), Cpx(2, 2), Cpx(0, 4)}, {Cpx(1, 0), Cpx(-2, 1), Cpx(1, 1)}});
+	const CpxMatrix B({{Cpx(2, 0), Cpx(1, 1), Cpx(0, 1)}, {Cpx(1, -1), Cpx(0, 3), Cpx(2, 0)}, {Cpx(-1, 1), Cpx(1, 0), Cpx(1, -2)}});
+	
+	const SplitMatrix SA(A);
+	const SplitMatrix SB(B);
+	
+	// split result
+	EXPECT_EQ(SplitMatrix(SA*SB), CpxMatrix(A*B));
+	EXPECT_EQ(SplitMatrix(2.*SA*FSLinalg::transpose(SB)), CpxMatrix(2.*A*FSLinalg::transpose(B)));
+	EXPECT_EQ(SplitMatrix(FSLinalg::conj(SA)*SB), CpxMatrix(FSLinalg::conj(A)*SB));
+	EXPECT_EQ(SplitMatrix(FSLinalg::adjoint(SA)*FSLinalg::conj(SB)), CpxMatrix(FSLinalg::adjoint(A)*FSLinalg::conj(B)));
+	EXPECT_EQ(SplitMatrix(Cpx(1, -1)*SA*SB), CpxMatrix(Cpx(1, -1)*A*B));
+	
+	// interleaved result and mixed operands
+	CpxMatrix C(SA*SB);
+	EXPECT_EQ(C, CpxMatrix(A*B));
+	
+	C += SA*FSLinalg::conj(B);
+	EXPECT_EQ(C, CpxMatrix(A*B + A*FSLinalg::conj(B)));
+	
+	C -= A*SB;
+	EXPECT_EQ(C, CpxMatrix(A*FSLinalg::conj(B)));
+	
+	SplitMatrix SC(SA);
+	SC = SC*SB;
+	EXPECT_EQ(SC, CpxMatrix(A*B));
+}
+
+TEST(split_complex, random_product)
+{
+	using SplitMatrix = FSLinalg::SplitCpxMatrix<5,5>;
+	using CpxMatrix   = FSLinalg::CpxMatrix<5,5>;
+	
+	// the split products (3M or 4M, see FSLINALG_CPX_3M) match the interleaved product up to rounding
+	const CpxMatrix A = CpxMatrix::random();
+	const CpxMatrix B = CpxMatrix::random();
+	
+	const SplitMatrix SA(A);
+	const SplitMatrix SB(B);
+	
+	const CpxMatrix expected = A*B + Cpx(0.5, -2.)*FSLinalg::adjoint(A)*FSLinalg::conj(B);
+	
+	CpxMatrix C(SA*SB);
+	C += Cpx(0.5, -2.)*FSLinalg::adjoint(SA)*FSLinalg::conj(SB);
+	
+	const SplitMatrix SC(0.5*FSLinalg::conj(SA)*FSLinalg::transpose(SB));
+	
+	const CpxMatrix expectedSC = 0.5*FSLinalg::conj(A)*FSLinalg::transpose(B);
+	
+	for (unsigned int i=0; i!=5; ++i)
+	{
+		for (unsigned int j=0; j!=5; ++j)
+		{
+			EXPECT_NEAR(std::abs(C(i,j)  - expected(i,j)),   0., 1e-12);
+			EXPECT_NEAR(std::abs(CpxMatrix(SC)(i,j) - expectedSC(i,j)), 0., 1e-12);
+		}
+	}
+}
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <FSLinalg/Tensor.hpp>
+#include <FSLinalg/Matrix.hpp>
 
 template<size_t rank> using Shape = std::array<unsigned int, rank>;
 
@@ -52,3 +53,343 @@ TEST(tensor, binary_ops)
 	
 	EXPECT_EQ(expr3, expected3);
 }
+
+TEST(tensor, scale_and_minus)
+{
+	FSLinalg::RealTensor<2,2> a({{2, 4}, {1, -3}});
+	FSLinalg::RealTensor<2,2> b({{1, 5}, {-1, 2}});
+	
+	FSLinalg::RealTensor<2,2> expected1({{5, 13}, {1, -4}});
+	FSLinalg::RealTensor<2,2> expected2({{-2, -4}, {-1, 3}});
+	FSLinalg::RealTensor<2,2> expected3({{1, 2}, {0.5, -1.5}});
+	
+	EXPECT_EQ(2.*a + b, expected1);
+	EXPECT_EQ(-a, expected2);
+	EXPECT_EQ(a/2., expected3);
+	
+	FSLinalg::RealTensor<2,2> c = a*2. - b;
+	c -= -(b*3.);
+	
+	FSLinalg::RealTensor<2,2> expected4({{6, 18}, {0, -2}});
+	
+	EXPECT_EQ(c, expected4);
+	
+	c = -(2.*c);
+	c *= 0.5*a;
+	
+	FSLinalg::RealTensor<2,2> expected5({{-12, -72}, {0, -6}});
+	
+	EXPECT_EQ(c, expected5);
+}
+
+TEST(tensor, strided_loop_layout)
+{
+	using Layout1 = FSLinalg::misc::StridedLoop<Shape<3>{2, 3, 4}, std::array{Shape<3>{12, 4, 1}, Shape<3>{12, 4, 1}}>;
+	using Layout2 = FSLinalg::misc::StridedLoop<Shape<3>{2, 3, 4}, std::array{Shape<3>{12, 4, 1}, Shape<3>{1, 8, 2}}>;
+	using Layout3 = FSLinalg::misc::StridedLoop<Shape<4>{2, 1, 3, 4}, std::array{Shape<4>{12, 12, 4, 1}, Shape<4>{1, 2, 8, 2}}>;
+	
+	EXPECT_EQ(Layout1::layout.nDims, 1);
+	EXPECT_EQ(Layout1::layout.extents[0], 24);
+	
+	EXPECT_EQ(Layout2::layout.nDims, 2);
+	EXPECT_EQ(Layout2::layout.extents[0], 2);
+	EXPECT_EQ(Layout2::layout.extents[1], 12);
+	EXPECT_EQ(Layout2::layout.steps[1][1], 2);
+	
+	EXPECT_EQ(Layout3::layout.nDims, 2);
+	
+	std::array<unsigned int, 24> visited{};
+	FSLinalg::misc::stridedLoop<Shape<3>{2, 3, 4}, std::array{Shape<3>{12, 4, 1}, Shape<3>{1, 8, 2}}>([&](const unsigned int i, const unsigned int j) -> void
+	{
+		visited[i] = j;
+	});
+	
+	for (unsigned int i=0; i!=2; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j)
+		{
+			for (unsigned int k=0; k!=4; ++k)
+			{
+				EXPECT_EQ(visited[12*i + 4*j + k], i + 8*j + 2*k);
+			}
+		}
+	}
+}
+
+TEST(tensor, permuted)
+{
+	FSLinalg::RealTensor<2,3,4> a = FSLinalg::RealTensor<2,3,4>::random();
+	FSLinalg::RealTensor<4,2,3> b = FSLinalg::RealTensor<4,2,3>::random();
+	
+	const FSLinalg::RealTensor<4,2,3> c = permute<2,0,1>(a);
+	const FSLinalg::RealTensor<4,2,3> d = 2.*permute<2,0,1>(a) - b;
+	const FSLinalg::RealTensor<2,3,4> e = permute<1,2,0>(b) + a;
+	
+	for (unsigned int i=0; i!=2; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j)
+		{
+			for (unsigned int k=0; k!=4; ++k)
+			{
+				EXPECT_EQ(c(k,i,j), a(i,j,k));
+				EXPECT_EQ(d(k,i,j), 2.*a(i,j,k) - b(k,i,j));
+				EXPECT_EQ(e(i,j,k), b(k,i,j) + a(i,j,k));
+			}
+		}
+	}
+	
+	FSLinalg::RealTensor<3,3> f({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+	FSLinalg::RealTensor<3,3> expected({{1, 4, 7}, {2, 5, 8}, {3, 6, 9}});
+	
+	f = permute<1,0>(f);
+	
+	EXPECT_EQ(f, expected);
+	
+	// an identity permutation keeps flat (hence strided) access
+	using Identity = decltype(permute<0,1>(f + f));
+	static_assert(Identity::hasFlatRandomAccess and Identity::hasStridedAccess);
+	EXPECT_EQ((permute<0,1>(f + f)[5]), 2.*f[5]);
+}
+
+TEST(tensor, mixed_strided_operands)
+{
+	const FSLinalg::RealTensor<2,3,4> a = FSLinalg::RealTensor<2,3,4>::random();
+	const FSLinalg::RealTensor<4,2,3> b = FSLinalg::RealTensor<4,2,3>::random();
+	const FSLinalg::RealTensor<4,2,3> c = FSLinalg::RealTensor<4,2,3>::random();
+	
+	// permuted and plain operands are read at their own offsets in a single strided loop
+	using Sum  = decltype(2.*permute<2,0,1>(a) - b);
+	using Madd = decltype(permute<2,0,1>(a)*b + c);
+	static_assert(not Sum::hasStridedAccess and FSLinalg::detail::StridedOperands<Sum>::value and FSLinalg::detail::StridedOperands<Sum>::n == 2);
+	static_assert(FSLinalg::detail::StridedOperands<Madd>::n == 3);
+	
+	const FSLinalg::RealTensor<4,2,3> d = 2.*permute<2,0,1>(a) - b;
+	const FSLinalg::RealTensor<4,2,3> e = permute<2,0,1>(a)*b + c;
+	const FSLinalg::RealTensor<4,2,3> f = -(b + permute<2,0,1>(a));
+	
+	for (unsigned int i=0; i!=2; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j)
+		{
+			for (unsigned int k=0; k!=4; ++k)
+			{
+				EXPECT_EQ(d(k,i,j), 2.*a(i,j,k) - b(k,i,j));
+				EXPECT_DOUBLE_EQ(e(k,i,j), a(i,j,k)*b(k,i,j) + c(k,i,j));
+				EXPECT_EQ(f(k,i,j), -(b(k,i,j) + a(i,j,k)));
+			}
+		}
+	}
+}
+
+TEST(tensor, reductions)
+{
+	FSLinalg::RealTensor<2,3,4> a;
+	for (unsigned int i=0; i!=a.size; ++i) { a[i] = double((7*i) % 11) - 5.; }
+	
+	FSLinalg::RealTensor<3,4> sum0(0.), max01(0.);
+	FSLinalg::RealTensor<2,4> sum1(0.);
+	FSLinalg::RealTensor<2,3> sum2(0.), norm2(0.);
+	FSLinalg::RealTensor<3>   sum02(0.);
+	double total = 0.;
+	for (unsigned int i=0; i!=2; ++i)
+	{
+		for (unsigned int j=0; j!=3; ++j)
+		{
+			for (unsigned int k=0; k!=4; ++k)
+			{
+				const double x = a(i,j,k);
+				sum0(j,k)  += x;
+				sum1(i,k)  += x;
+				sum2(i,j)  += x;
+				sum02(j)   += x;
+				norm2(i,j) += x*x;
+				total      += x;
+			}
+		}
+	}
+	
+	using Tens34 = FSLinalg::RealTensor<3,4>;
+	using Tens24 = FSLinalg::RealTensor<2,4>;
+	using Tens23 = FSLinalg::RealTensor<2,3>;
+	using Tens3  = FSLinalg::RealTensor<3>;
+	
+	EXPECT_TRUE(Tens34(FSLinalg::sum<0>(a)) == sum0);
+	EXPECT_TRUE(Tens24(FSLinalg::sum<1>(a)) == sum1);
+	EXPECT_TRUE(Tens23(FSLinalg::sum<2>(a)) == sum2);
+	EXPECT_TRUE(Tens3(FSLinalg::sum<2,0>(a)) == sum02);
+	EXPECT_TRUE(Tens24(FSLinalg::mean<1>(a)) == Tens24(sum1/3.));
+	EXPECT_EQ(FSLinalg::sum(a), total);
+	const double explicitTotal = FSLinalg::sum<0,1,2>(a);
+	EXPECT_EQ(explicitTotal, total);
+	EXPECT_EQ(FSLinalg::mean(a), total/24.);
+	
+	const Tens23 n2 = FSLinalg::norm<2>(a);
+	for (unsigned int i=0; i!=n2.size; ++i) { EXPECT_DOUBLE_EQ(n2[i], std::sqrt(norm2[i])); }
+	
+	const FSLinalg::RealTensor<4> m = FSLinalg::max<0,1>(a);
+	for (unsigned int k=0; k!=4; ++k)
+	{
+		double expected = a(0u,0u,k);
+		for (unsigned int i=0; i!=2; ++i) { for (unsigned int j=0; j!=3; ++j) { expected = std::max(expected, a(i,j,k)); } }
+		EXPECT_EQ(m(k), expected);
+	}
+	EXPECT_EQ(FSLinalg::max(a), 5.);
+	
+	// reductions are lazy operands of tensor expressions
+	Tens34 b;
+	for (unsigned int i=0; i!=b.size; ++i) { b[i] = 0.5*double(i); }
+	Tens34 c = 2.*FSLinalg::sum<0>(a) - b;
+	EXPECT_TRUE(c == Tens34(2.*sum0 - b));
+	c += FSLinalg::sum<0>(a);
+	EXPECT_TRUE(c == Tens34(3.*sum0 - b));
+	
+	// strided operands with non-contiguous reduced axes, and reductions of reductions
+	const FSLinalg::RealTensor<4,3> p1 = FSLinalg::sum<1>(FSLinalg::permute<2,0,1>(a));
+	const FSLinalg::RealTensor<3,2> p0 = FSLinalg::sum<0>(FSLinalg::permute<2,1,0>(a));
+	EXPECT_TRUE((p1 == FSLinalg::permute<1,0>(sum0)));
+	EXPECT_TRUE((p0 == FSLinalg::permute<1,0>(sum2)));
+	EXPECT_TRUE(Tens3(FSLinalg::sum<0>(FSLinalg::sum<2>(a))) == sum02);
+	
+	FSLinalg::CpxTensor<2,2> z(0.);
+	z(0u,0u) = {1., 2.};
+	z(1u,0u) = {3., -1.};
+	z(1u,1u) = {0., 4.};
+	const FSLinalg::CpxTensor<2> zs = FSLinalg::sum<0>(z);
+	EXPECT_EQ(zs(0u), std::complex<double>(4., 1.));
+	EXPECT_EQ(zs(1u), std::complex<double>(0., 4.));
+}
+
+TEST(tensor, matrix_maps)
+{
+	using Tens34 = FSLinalg::RealTensor<3,4>;
+	using Mat34  = FSLinalg::RealMatrix<3,4>;
+	using Mat32  = FSLinalg::RealMatrix<3,2>;
+	
+	Tens34 a, b;
+	for (unsigned int i=0; i!=a.size; ++i) { a[i] = 0.5*double(i); b[i] = 1. - 0.25*double(i); }
+	
+	FSLinalg::RealMatrix<4,2> B;
+	for (unsigned int i=0; i!=B.size; ++i) { B[i] = double(i) - 3.; }
+	
+	// elementwise results feed the products through their storage
+	const Tens34 c = a*b;
+	Mat34 copyC;
+	for (unsigned int i=0; i!=c.size; ++i) { copyC[i] = c[i]; }
+	
+	const Mat32 Y = c.asMatrix()*B;
+	EXPECT_TRUE(Y == Mat32(copyC*B));
+	EXPECT_EQ(c.asMatrix().data(), c.data());
+	
+	// products written through a map land in the tensor
+	FSLinalg::RealTensor<3,2> t;
+	t.asMatrix() = copyC*B;
+	t.asMatrix() += c.asMatrix()*B;
+	for (unsigned int i=0; i!=t.size; ++i) { EXPECT_EQ(t[i], 2.*Y[i]); }
+	
+	// skew operands take a copy of the map
+	FSLinalg::RealTensor<3,4> s;
+	s.asMatrix() = FSLinalg::skew(FSLinalg::RealColVector<3>{1., 2., 3.})*c.asMatrix();
+	EXPECT_TRUE(s.asMatrix() == Mat34(FSLinalg::skew(FSLinalg::RealColVector<3>{1., 2., 3.})*copyC));
+	
+	// leading dimensions are flattened into rows, or reshaped explicitly
+	FSLinalg::RealTensor<2,3,4> r;
+	for (unsigned int i=0; i!=r.size; ++i) { r[i] = double(i); }
+	const auto flat = r.asMatrix();
+	const auto wide = r.asMatrix<2,12>();
+	EXPECT_EQ(flat.nRows, 6u);
+	EXPECT_EQ(flat.nCols, 4u);
+	EXPECT_EQ(flat(5,3), r(1u,2u,3u));
+	EXPECT_EQ(wide(1,7), r(1u,1u,3u));
+	
+	// matrices take the tensor API through asTensor()
+	Mat34 M = copyC;
+	M.asTensor() *= b;
+	EXPECT_TRUE(M.asTensor() == Tens34(c*b));
+	EXPECT_EQ((M.asTensor<2,6>()(1u,0u)), M(1,2));
+	
+	// maps of the destination are detected, reshaped or not
+	FSLinalg::RealMatrix<3,3> S;
+	for (unsigned int i=0; i!=S.size; ++i) { S[i] = double(i) - 4.; }
+	const FSLinalg::RealMatrix<3,3> S2 = S*S;
+	S.asTensor().asMatrix() = S*S;
+	EXPECT_TRUE(S == S2);
+	
+	FSLinalg::RealMatrix<2,3> R;
+	for (unsigned int i=0; i!=R.size; ++i) { R[i] = double(i); }
+	const FSLinalg::RealMatrix<3,2> Rt = FSLinalg::transpose(R);
+	R.asTensor<3,2>().asMatrix() = FSLinalg::transpose(R);
+	for (unsigned int i=0; i!=R.size; ++i) { EXPECT_EQ(R[i], Rt[i]); }
+}
+
+TEST(tensor, symmetric_tensor4)
+{
+	using Tens3333 = FSLinalg::RealTensor<3,3,3,3>;
+	using Tens33   = FSLinalg::RealTensor<3,3>;
+	using FSLinalg::Symmetry4;
+	
+	EXPECT_EQ((FSLinalg::SymmetricTensor4<double, 3, Symmetry4::Minor>::nStored), 36u);
+	EXPECT_EQ((FSLinalg::SymmetricTensor4<double, 3, Symmetry4::Major>::nStored), 21u);
+	EXPECT_EQ((FSLinalg::SymmetricTensor4<double, 3, Symmetry4::Full >::nStored), 15u);
+	EXPECT_EQ((FSLinalg::SymmetricTensor4<double, 2, Symmetry4::Major>::nStored),  6u);
+	
+	// isotropic elasticity, lambda*d_ij*d_kl + mu*(d_ik*d_jl + d_il*d_jk), with dyadic values for exact means
+	const double lambda = 2.;
+	const double mu     = 0.5;
+	const auto delta = [](const unsigned int i, const unsigned int j) -> double { return (i == j) ? 1. : 0.; };
+	
+	Tens3333 iso;
+	FSLinalg::misc::nestedLoop(iso.shape, [&](const std::array<unsigned int, 4>& x) -> void
+	{
+		iso(x) = lambda*delta(x[0],x[1])*delta(x[2],x[3]) + mu*(delta(x[0],x[2])*delta(x[1],x[3]) + delta(x[0],x[3])*delta(x[1],x[2]));
+	});
+	
+	const FSLinalg::ElasticityTensor<3> C(iso);
+	EXPECT_TRUE(Tens3333(C) == iso);
+	EXPECT_EQ(C(0u,1u,0u,1u), mu);
+	EXPECT_EQ(C.toVoigt()(0,1), lambda);
+	EXPECT_EQ(C.toVoigt()(5,5), mu);
+	EXPECT_EQ(C.toMandel()(5,5), 2.*mu);
+	EXPECT_TRUE(Tens3333(FSLinalg::ElasticityTensor<3>::fromVoigt(C.toVoigt())) == iso);
+	EXPECT_TRUE(Tens3333(FSLinalg::ElasticityTensor<3>::fromMandel(C.toMandel())) == iso);
+	
+	// symmetric entries share their slot
+	FSLinalg::ElasticityTensor<3> D = C;
+	D.slot(0u,1u,2u,2u) = 3.;
+	EXPECT_EQ(D(1u,0u,2u,2u), 3.);
+	EXPECT_EQ(D(2u,2u,0u,1u), 3.);
+	
+	// C : eps against the explicit sum, on tensors and on Mandel vectors
+	Tens33 eps;
+	for (unsigned int i=0; i!=eps.size; ++i) { eps[i] = 0.125*double(i) - 0.5; }
+	
+	Tens33 expected(0.);
+	FSLinalg::misc::nestedLoop(iso.shape, [&](const std::array<unsigned int, 4>& x) -> void { expected(x[0],x[1]) += iso(x)*eps(x[2],x[3]); });
+	
+	const Tens33 sigma = FSLinalg::doubleContraction(C, eps);
+	for (unsigned int i=0; i!=sigma.size; ++i) { EXPECT_DOUBLE_EQ(sigma[i], expected[i]); }
+	
+	using Elasticity = FSLinalg::ElasticityTensor<3>;
+	const Elasticity::MandelVector sigmaMandel = FSLinalg::doubleContraction(C, Elasticity::mandel(eps));
+	const Elasticity::MandelVector viaMatrix   = C.toMandel()*Elasticity::mandel(eps);
+	for (unsigned int I=0; I!=6; ++I) { EXPECT_NEAR(sigmaMandel[I], viaMatrix[I], 1e-14); }
+	
+	const Tens33 back = Elasticity::unmandel(sigmaMandel);
+	for (unsigned int i=0; i!=back.size; ++i) { EXPECT_NEAR(back[i], expected[i], 1e-14); }
+	
+	// projections of a generic tensor keep the means of the orbits
+	Tens3333 a;
+	for (unsigned int i=0; i!=a.size; ++i) { a[i] = double((i*37u)%11u) - 5.; }
+	
+	const FSLinalg::SymmetricTensor4<double, 3, Symmetry4::Minor> minor(a);
+	const FSLinalg::SymmetricTensor4<double, 3, Symmetry4::Full>  full(a);
+	EXPECT_EQ(minor(0u,1u,2u,0u), 0.25*(a(0u,1u,2u,0u) + a(1u,0u,2u,0u) + a(0u,1u,0u,2u) + a(1u,0u,0u,2u)));
+	EXPECT_NE(minor(0u,1u,2u,0u), minor(2u,0u,0u,1u));
+	EXPECT_EQ(full(0u,1u,2u,2u), full(2u,0u,2u,1u));
+	
+	// minor symmetry makes C : eps the contraction with the symmetric part of eps
+	Tens33 expectedMinor(0.);
+	const Tens3333 minorFull(minor);
+	FSLinalg::misc::nestedLoop(a.shape, [&](const std::array<unsigned int, 4>& x) -> void { expectedMinor(x[0],x[1]) += minorFull(x)*eps(x[2],x[3]); });
+	const Tens33 sigmaMinor = FSLinalg::doubleContraction(minor, eps);
+	for (unsigned int i=0; i!=sigmaMinor.size; ++i) { EXPECT_NEAR(sigmaMinor[i], expectedMinor[i], 1e-12); }
+}